@@ -5,6 +5,7 @@
 #include <mutex>
 #include <random>
 #include <chrono>
+#include <cstdlib>
 #include <ranges>
 #include <vector>
 #include <spanstream>
@@ -18,11 +19,16 @@
 #include "Client/Render/Model.hpp"
 #include "Client/Render/Vertices/FatVertex.hpp"
 #include "Independent/Physics/PhysicsSystem.hpp"
+#include "Independent/ECS/Synchronization/DemoPlayer.hpp"
 #include "Independent/ECS/Synchronization/ReceiverSynchronization.hpp"
 #include "Independent/ECS/GameObjectManager.hpp"
+#include "Independent/Network/AssetTransfer.hpp"
+#include "Independent/Network/WorldChunk.hpp"
 #include "Independent/Test/PhysicsDebugger.hpp"
 #include "Independent/Thread/MainThreadExecutor.hpp"
+#include "Independent/Utility/AssetCache.hpp"
 #include "Independent/Utility/Time.hpp"
+#include "Server/Entity/Entities/EntityPlayer.hpp"
 
 using namespace std::chrono_literals;
 using namespace Blaster::Client::Core;
@@ -70,6 +76,8 @@ namespace Blaster::Client
 
             InputManager::GetInstance().Initialize();
 
+            Blaster::Server::Entity::Entities::EntityPlayer::RegisterPrefabs();
+
 #ifdef _WIN32
             PhysicsDebugger::Initialize();
 #endif
@@ -77,6 +85,12 @@ namespace Blaster::Client
 
         void Initialize()
         {
+            if (const char* demoPath = std::getenv("BLASTER_DEMO_PLAY"); demoPath != nullptr)
+            {
+                InitializeDemoPlayback(demoPath);
+                return;
+            }
+
             std::string ip;
             std::uint16_t port;
 
@@ -96,61 +110,105 @@ namespace Blaster::Client
 
             const int randomNumber = distribution(generator);
 
+            ClientNetwork::GetInstance().SetResumeSequenceProvider([]
+                {
+                    return SyncTracker::GetInstance().GetLastIncoming(0);
+                });
+
             ClientNetwork::GetInstance().Initialize(ip, port, "Player" + std::to_string(randomNumber));
 
             ClientNetwork::GetInstance().AddOnServerConnectionLostCallback([&]()
                 {
                     camera = std::nullopt;
+                    worldReady = false;
                     GameObjectManager::GetInstance().Clear();
                 });
 
+            ClientNetwork::GetInstance().AddOnZoneRedirectCallback([&]()
+                {
+                    camera = std::nullopt;
+                    worldReady = false;
+                    GameObjectManager::GetInstance().Clear();
+                    SyncTracker::GetInstance().ForgetPeer(0);
+                    ReceiverSynchronization::GetInstance().ForgetBaselines();
+                    ReceiverSynchronization::GetInstance().ForgetEntities();
+
+                    BeginCameraSearch();
+                });
+
             ClientNetwork::GetInstance().RegisterReceiver(PacketType::S2C_Snapshot, [](std::vector<std::uint8_t> messageIn)
                 {
-                    MainThreadExecutor::GetInstance().EnqueueTask(nullptr, [message = std::move(messageIn)]
-                        {
-                            ReceiverSynchronization::GetInstance().HandleSnapshotPayload(message);
-                        });
+                    ReceiverSynchronization::GetInstance().EnqueueSnapshotPayload(std::move(messageIn));
                 });
 
-            PhysicsWorld::GetInstance().Initialize();
+            ClientNetwork::GetInstance().RegisterReceiver(PacketType::S2C_WorldChunk, [this](std::vector<std::uint8_t> messageIn)
+                {
+                    auto anyList = CommonNetwork::DisassembleData(messageIn);
 
-            camera = std::nullopt;
+                    if (anyList.empty())
+                        return;
 
-            std::thread([this]() mutable
-            {
-                while (!camera.has_value())
-                {
-                    std::this_thread::sleep_for(1s);
+                    const auto& chunk = std::any_cast<const WorldChunk&>(anyList.front());
 
-                    const auto optionalPlayer = GameObjectManager::GetInstance().Get("player-" + ClientNetwork::GetInstance().GetStringId());
+                    auto payload = WorldChunkCodec::Decompress(chunk);
 
-                    if (!optionalPlayer.has_value())
+                    if (!payload.has_value())
                     {
-                        std::cerr << "Failed to find player game object!" << std::endl;
-                        continue;
-                    } 
+                        std::cerr << "Failed to decompress world chunk '" << chunk.index << "'." << std::endl;
+                        return;
+                    }
 
-                    const auto& player = optionalPlayer.value();
+                    ReceiverSynchronization::GetInstance().EnqueueSnapshotPayload(std::move(payload.value()));
 
-                    const auto optionalCamera = GameObjectManager::GetInstance().Get(player->GetAbsolutePath() + ".camera");
+                    if (chunk.HasFlag(WorldChunkFlag::Essential))
+                        worldReady = true;
 
-                    if (!optionalCamera.has_value())
-                    {
-                        std::cerr << "Failed to find player's camera game object!" << std::endl;
-                        continue;
-                    }
+                    if (chunk.HasFlag(WorldChunkFlag::Final))
+                        std::cout << "Received final world chunk '" << chunk.index << "'." << std::endl;
+                });
 
-                    const auto& camera = optionalCamera.value();
+            AssetCache::GetInstance().SetRequestFunction([](const AssetHash& hash)
+                {
+                    ClientNetwork::GetInstance().Send(PacketType::C2S_AssetRequest, AssetRequest{ hash });
+                });
 
-                    if (!camera->HasComponent<Camera>())
-                    {
-                        std::cerr << "Failed to find player's camera's camera component!" << std::endl;
-                        continue;
-                    }
+            ClientNetwork::GetInstance().RegisterReceiver(PacketType::S2C_AssetRequest, [](std::vector<std::uint8_t> messageIn)
+                {
+                    auto anyList = CommonNetwork::DisassembleData(messageIn);
 
-                    this->camera = camera->GetComponent<Camera>();
-                }
-            }).detach();
+                    if (anyList.empty())
+                        return;
+
+                    const auto& request = std::any_cast<const AssetRequest&>(anyList.front());
+
+                    const auto bytes = AssetCache::GetInstance().Find(request.hash);
+
+                    if (!bytes.has_value())
+                        return;
+
+                    ClientNetwork::GetInstance().Send(PacketType::C2S_AssetData, AssetData{ request.hash, { bytes->begin(), bytes->end() } });
+                });
+
+            ClientNetwork::GetInstance().RegisterReceiver(PacketType::S2C_AssetData, [](std::vector<std::uint8_t> messageIn)
+                {
+                    auto anyList = CommonNetwork::DisassembleData(messageIn);
+
+                    if (anyList.empty())
+                        return;
+
+                    const auto& data = std::any_cast<const AssetData&>(anyList.front());
+
+                    AssetCache::GetInstance().Store(data.hash, { data.bytes.begin(), data.bytes.end() });
+                });
+
+            PhysicsWorld::GetInstance().Initialize();
+
+            if (const char* demoPath = std::getenv("BLASTER_DEMO_RECORD"); demoPath != nullptr)
+                DemoRecorder::GetInstance().Start(demoPath);
+
+            camera = std::nullopt;
+
+            BeginCameraSearch();
         }
 
         bool IsRunning()
@@ -164,10 +222,21 @@ namespace Blaster::Client
 
             GameObjectManager::GetInstance().Update();
 
-            PhysicsSystem::GetInstance().Update();
+            if (worldReady)
+                PhysicsSystem::GetInstance().Update();
 
             TranslationBuffer::GetInstance().Update();
 
+            AssetCache::GetInstance().Pump();
+
+            if (DemoPlayer::GetInstance().IsPlaying())
+                UpdateDemoPlayback();
+            else
+                SenderSynchronization::GetInstance().Tick();
+
+            if (DemoRecorder::GetInstance().IsKeyframeDue())
+                DemoRecorder::GetInstance().RecordKeyframe(SenderSynchronization::GetInstance().BuildFullSnapshot(GameObjectManager::GetInstance().GetAll()));
+
             Time::GetInstance().Update();
         }
 
@@ -184,6 +253,8 @@ namespace Blaster::Client
 
         void Uninitialize()
         {
+            DemoRecorder::GetInstance().Stop();
+
             ClientNetwork::GetInstance().Uninitialize();
 
 #ifdef _WIN32
@@ -206,8 +277,104 @@ namespace Blaster::Client
 
         ClientApplication() = default;
 
+        void InitializeDemoPlayback(const std::string& path)
+        {
+            PhysicsWorld::GetInstance().Initialize();
+
+            if (const char* speed = std::getenv("BLASTER_DEMO_SPEED"); speed != nullptr)
+                DemoPlayer::GetInstance().SetSpeed(std::strtod(speed, nullptr));
+
+            if (const char* view = std::getenv("BLASTER_DEMO_VIEW"); view != nullptr)
+                viewName = view;
+
+            if (!DemoPlayer::GetInstance().Open(path))
+                return;
+
+            camera = std::nullopt;
+
+            BeginCameraSearch();
+        }
+
+        void UpdateDemoPlayback()
+        {
+            DemoPlayer& player = DemoPlayer::GetInstance();
+
+            if (InputManager::GetInstance().GetKeyState(KeyCode::P, KeyState::PRESSED))
+                player.SetPaused(!player.IsPaused());
+
+            if (InputManager::GetInstance().GetKeyState(KeyCode::UP, KeyState::PRESSED))
+                player.SetSpeed(player.GetSpeed() * 2.0);
+
+            if (InputManager::GetInstance().GetKeyState(KeyCode::DOWN, KeyState::PRESSED))
+                player.SetSpeed(player.GetSpeed() * 0.5);
+
+            const bool seekForward = InputManager::GetInstance().GetKeyState(KeyCode::RIGHT, KeyState::PRESSED);
+            const bool seekBackward = InputManager::GetInstance().GetKeyState(KeyCode::LEFT, KeyState::PRESSED);
+
+            if (seekForward || seekBackward)
+            {
+                player.Seek(player.GetTime() + (seekForward ? kDemoSeekStep : -kDemoSeekStep));
+
+                if (!camera.has_value())
+                    return;
+
+                camera = std::nullopt;
+
+                BeginCameraSearch();
+
+                return;
+            }
+
+            player.Update(Time::GetInstance().GetDeltaTime());
+        }
+
+        void BeginCameraSearch()
+        {
+            std::thread([this]() mutable
+            {
+                while (!camera.has_value())
+                {
+                    std::this_thread::sleep_for(1s);
+
+                    const auto optionalPlayer = GameObjectManager::GetInstance().Get("player-" + (viewName.empty() ? ClientNetwork::GetInstance().GetStringId() : viewName));
+
+                    if (!optionalPlayer.has_value())
+                    {
+                        std::cerr << "Failed to find player game object!" << std::endl;
+                        continue;
+                    } 
+
+                    const auto& player = optionalPlayer.value();
+
+                    const auto optionalCamera = GameObjectManager::GetInstance().Get(player->GetAbsolutePath() + ".camera");
+
+                    if (!optionalCamera.has_value())
+                    {
+                        std::cerr << "Failed to find player's camera game object!" << std::endl;
+                        continue;
+                    }
+
+                    const auto& camera = optionalCamera.value();
+
+                    if (!camera->HasComponent<Camera>())
+                    {
+                        std::cerr << "Failed to find player's camera's camera component!" << std::endl;
+                        continue;
+                    }
+
+                    this->camera = camera->GetComponent<Camera>();
+                }
+            }).detach();
+        }
+
         std::optional<std::shared_ptr<Camera>> camera;
 
+        std::atomic<bool> worldReady = false;
+
+        std::string viewName;
+
+        static constexpr double kDemoSeekStep = 10.0;
+
         static std::once_flag initializationFlag;
         static std::unique_ptr<ClientApplication> instance;
 
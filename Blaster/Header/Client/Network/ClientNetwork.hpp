@@ -7,6 +7,8 @@
 #include <thread>
 #include <boost/asio.hpp>
 #include "Independent/Network/CommonNetwork.hpp"
+#include "Independent/Network/SessionTicket.hpp"
+#include "Independent/Network/ZoneHandoff.hpp"
 #include "Independent/Thread/MainThreadExecutor.hpp"
 
 using namespace Blaster::Independent::Network;
@@ -33,11 +35,11 @@ namespace Blaster::Client::Network
 
             TcpProtocol::resolver res{ioContext};
 
-            const auto resolution = res.resolve(host, std::to_string(port));
+            endpoints = res.resolve(host, std::to_string(port));
 
             try
             {
-                boost::asio::connect(socket, resolution);
+                boost::asio::connect(socket, endpoints);
             }
             catch (const boost::system::system_error& error)
             {
@@ -90,6 +92,16 @@ namespace Blaster::Client::Network
             onServerConnectionLostCallbackList.push_back(callback);
         }
 
+        void AddOnZoneRedirectCallback(const std::function<void()>& callback)
+        {
+            onZoneRedirectCallbackList.push_back(callback);
+        }
+
+        void SetResumeSequenceProvider(const std::function<std::uint64_t()>& provider)
+        {
+            resumeSequenceProvider = provider;
+        }
+
         auto& GetIoContext()
         {
             return ioContext;
@@ -148,6 +160,102 @@ namespace Blaster::Client::Network
             running = false;
         }
 
+        void BeginResume()
+        {
+            resuming = true;
+            resumeRequested = false;
+            resumeDeadline = std::chrono::steady_clock::now() + kResumeWindow;
+
+            std::cout << "Connection to server lost; attempting to resume session '" << sessionTicket->id << "'." << std::endl;
+
+            AttemptReconnect();
+        }
+
+        void AttemptReconnect()
+        {
+            ErrorCode ignored;
+
+            socket.close(ignored);
+            socket = TcpProtocol::socket(ioContext);
+
+            boost::asio::async_connect(socket, endpoints, boost::asio::bind_executor(strand, [this](const ErrorCode& errorCode, const TcpProtocol::endpoint&)
+                {
+                    if (errorCode)
+                    {
+                        if (std::chrono::steady_clock::now() >= resumeDeadline)
+                        {
+                            AbandonResume();
+                            return;
+                        }
+
+                        disconnectTimer.expires_after(std::chrono::seconds(1));
+                        disconnectTimer.async_wait(boost::asio::bind_executor(strand, [this](const ErrorCode& waitError)
+                            {
+                                if (!waitError)
+                                    AttemptReconnect();
+                            }));
+
+                        return;
+                    }
+
+                    socket.set_option(TcpProtocol::no_delay(true));
+
+                    inbox.clear();
+                    writeQueue.clear();
+
+                    BeginRead();
+                }));
+        }
+
+        void BeginRedirect(const ZoneRedirect& redirect)
+        {
+            std::cout << "Server moved us to zone server '" << redirect.host << ":" << redirect.port << "'." << std::endl;
+
+            sessionTicket.reset();
+            resuming = false;
+            resumeRequested = false;
+            claimToken = redirect.token;
+
+            CancelDisconnectCountdown();
+
+            MainThreadExecutor::GetInstance().EnqueueTask(this, [this]()
+                {
+                    for (auto& callback : onZoneRedirectCallbackList)
+                        callback();
+                });
+
+            try
+            {
+                TcpProtocol::resolver resolver{ ioContext };
+
+                endpoints = resolver.resolve(redirect.host, std::to_string(redirect.port));
+            }
+            catch (const boost::system::system_error& error)
+            {
+                std::cerr << "Failed to resolve zone server: " << error.what() << '\n';
+
+                AbandonResume();
+
+                return;
+            }
+
+            resumeDeadline = std::chrono::steady_clock::now() + kResumeWindow;
+
+            AttemptReconnect();
+        }
+
+        void AbandonResume()
+        {
+            resuming = false;
+            resumeRequested = false;
+            sessionTicket.reset();
+
+            MainThreadExecutor::GetInstance().EnqueueTask(this, [&]()
+                {
+                    NotifyConnectionLost();
+                });
+        }
+
         void StartWrite()
         {
             boost::asio::async_write(socket, boost::asio::buffer(*writeQueue.front()), boost::asio::bind_executor(strand, [this](const ErrorCode& error, std::size_t)
@@ -173,6 +281,9 @@ namespace Blaster::Client::Network
         {
             socket.async_read_some(boost::asio::buffer(readBuffer), boost::asio::bind_executor(strand, [this] (const ErrorCode& errorCode, const std::size_t number)
                 {
+                    if (errorCode == boost::asio::error::operation_aborted)
+                        return;
+
                     if (errorCode)
                     {
                         std::cerr << "ClientNetwork: read failed: " << errorCode.message() << '\n';
@@ -202,6 +313,18 @@ namespace Blaster::Client::Network
                         HandlePacket(*header, std::move(payload));
 
                         inbox.erase(inbox.begin(), inbox.begin() + need);
+
+                        if (pendingRedirect.has_value())
+                        {
+                            const ZoneRedirect redirect = std::move(pendingRedirect.value());
+
+                            pendingRedirect.reset();
+                            inbox.clear();
+
+                            BeginRedirect(redirect);
+
+                            return;
+                        }
                     }
 
                     BeginRead();
@@ -212,6 +335,26 @@ namespace Blaster::Client::Network
         {
             if (header.type == PacketType::S2C_RequestStringId)
             {
+                if (claimToken.has_value())
+                {
+                    Send(PacketType::C2S_ClaimHandoff, HandoffToken{ claimToken.value() });
+
+                    claimToken.reset();
+
+                    return;
+                }
+
+                if (resuming && sessionTicket.has_value())
+                {
+                    resumeRequested = true;
+
+                    const std::uint64_t lastSequence = resumeSequenceProvider ? resumeSequenceProvider() : 0;
+
+                    Send(PacketType::C2S_ResumeSession, ResumeRequest{ sessionTicket->id, sessionTicket->token, lastSequence });
+
+                    return;
+                }
+
                 Send(PacketType::C2S_StringId, stringId);
 
                 return;
@@ -219,12 +362,42 @@ namespace Blaster::Client::Network
 
             if (header.type == PacketType::S2C_AssignNetworkId)
             {
+                if (resuming && !resumeRequested)
+                    return;
+
                 const NetworkId id = std::any_cast<NetworkId>(CommonNetwork::DisassembleData(data)[0]);
 
                 std::cout << "Received NetworkId ('" << id << "') from the server." << std::endl;
 
                 this->networkId = id;
 
+                resuming = false;
+                resumeRequested = false;
+
+                return;
+            }
+
+            if (header.type == PacketType::S2C_SessionTicket)
+            {
+                if (!resuming)
+                    sessionTicket = std::any_cast<SessionTicket>(CommonNetwork::DisassembleData(data)[0]);
+
+                return;
+            }
+
+            if (header.type == PacketType::S2C_ZoneRedirect)
+            {
+                pendingRedirect = std::any_cast<ZoneRedirect>(CommonNetwork::DisassembleData(data)[0]);
+
+                return;
+            }
+
+            if (header.type == PacketType::S2C_ResumeRejected)
+            {
+                std::cerr << "Server rejected session resume." << std::endl;
+
+                AbandonResume();
+
                 return;
             }
 
@@ -243,15 +416,21 @@ namespace Blaster::Client::Network
             disconnectTimer.expires_after(std::chrono::seconds(2));
             disconnectTimer.async_wait(boost::asio::bind_executor(strand, [this](const ErrorCode& errorCode)
                 {
-                    if (!errorCode)
+                    disconnectTimerActive = false;
+
+                    if (errorCode || resuming)
+                        return;
+
+                    if (sessionTicket.has_value())
                     {
-                        MainThreadExecutor::GetInstance().EnqueueTask(this, [&]()
-                            {
-                                NotifyConnectionLost();
-                            });
+                        BeginResume();
+                        return;
                     }
 
-                    disconnectTimerActive = false;
+                    MainThreadExecutor::GetInstance().EnqueueTask(this, [&]()
+                        {
+                            NotifyConnectionLost();
+                        });
                 }));
         }
 
@@ -267,6 +446,7 @@ namespace Blaster::Client::Network
 
         boost::asio::io_context ioContext;
         TcpProtocol::socket socket{ioContext};
+        TcpProtocol::resolver::results_type endpoints;
         std::thread ioThread;
         std::atomic<bool> running = false;
 
@@ -274,12 +454,25 @@ namespace Blaster::Client::Network
         std::atomic<bool> disconnectTimerActive{ false };
 
         std::vector<std::function<void()>> onServerConnectionLostCallbackList;
+        std::vector<std::function<void()>> onZoneRedirectCallbackList;
 
         std::mutex callbackMutex;
 
         std::string stringId;
         NetworkId networkId = 0;
 
+        std::optional<SessionTicket> sessionTicket;
+        std::function<std::uint64_t()> resumeSequenceProvider;
+
+        std::optional<ZoneRedirect> pendingRedirect;
+        std::optional<std::uint64_t> claimToken;
+
+        bool resuming = false;
+        bool resumeRequested = false;
+        std::chrono::steady_clock::time_point resumeDeadline;
+
+        inline static constexpr std::chrono::seconds kResumeWindow{ 12 };
+
         std::array<std::uint8_t, 512> readBuffer = { };
         std::vector<std::uint8_t> inbox;
 
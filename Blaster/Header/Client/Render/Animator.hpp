@@ -3,10 +3,12 @@
 #include "Client/Render/Skeleton.hpp"
 #include "Independent/ComponentRegistry.hpp"
 #include "Independent/ECS/Synchronization/SenderSynchronization.hpp"
+#include "Independent/ECS/Synchronization/SnapshotScheduler.hpp"
 #include "Independent/ECS/Component.hpp"
 #include "Independent/Utility/Time.hpp"
 
 using namespace Blaster::Independent::ECS;
+using namespace Blaster::Independent::ECS::Synchronization;
 using namespace Blaster::Independent::Utility;
 
 namespace Blaster::Client::Render
@@ -14,24 +16,29 @@ namespace Blaster::Client::Render
     enum class WrapMode { ONCE, LOOP };
     enum class BlendMode { OVERWRITE, ADDITIVE };
 
-    struct ActiveNet
+    struct AnimationEvent
     {
-        std::string clipName;
+        std::uint32_t clipId = 0;
 
-        float time = 0.f;
+        std::uint64_t startTick = 0;
+        std::uint64_t stopTick = kPlaying;
+
+        float startTime = 0.f;
         float speed = 1.f;
-        float weight = 1.f;
-        float fadeVel = 0.f;
+        float fadeIn = 0.f;
+        float fadeOut = 0.f;
 
         WrapMode wrap = WrapMode::LOOP;
         BlendMode blend = BlendMode::OVERWRITE;
 
-        bool operator==(const ActiveNet& other) const
+        static constexpr std::uint64_t kPlaying = std::numeric_limits<std::uint64_t>::max();
+
+        bool operator==(const AnimationEvent& other) const
         {
-            return OPERATOR_CHECK(clipName, time, speed, weight, fadeVel, wrap, blend);
+            return OPERATOR_CHECK(clipId, startTick, stopTick, startTime, speed, fadeIn, fadeOut, wrap, blend);
         }
 
-        bool operator!=(const ActiveNet& other) const
+        bool operator!=(const AnimationEvent& other) const
         {
             return !(*this == other);
         }
@@ -39,11 +46,13 @@ namespace Blaster::Client::Render
         template <typename Archive>
         void serialize(Archive& archive, const unsigned)
         {
-            archive & BOOST_SERIALIZATION_NVP(clipName);
-            archive & BOOST_SERIALIZATION_NVP(time);
+            archive & BOOST_SERIALIZATION_NVP(clipId);
+            archive & BOOST_SERIALIZATION_NVP(startTick);
+            archive & BOOST_SERIALIZATION_NVP(stopTick);
+            archive & BOOST_SERIALIZATION_NVP(startTime);
             archive & BOOST_SERIALIZATION_NVP(speed);
-            archive & BOOST_SERIALIZATION_NVP(weight);
-            archive & BOOST_SERIALIZATION_NVP(fadeVel);
+            archive & BOOST_SERIALIZATION_NVP(fadeIn);
+            archive & BOOST_SERIALIZATION_NVP(fadeOut);
             archive & BOOST_SERIALIZATION_NVP(wrap);
             archive & BOOST_SERIALIZATION_NVP(blend);
         }
@@ -83,7 +92,13 @@ namespace Blaster::Client::Render
 
         void AddClip(AnimationClip clip)
         {
-            clips[clip.name] = std::move(clip);
+            const std::uint32_t clipId = MakeClipId(clip.name);
+
+            auto& stored = clips[clip.name];
+
+            stored = std::move(clip);
+
+            clipIdMap[clipId] = &stored;
 
             ResolvePending();
         }
@@ -105,20 +120,23 @@ namespace Blaster::Client::Render
             if (iterator == clips.end())
                 return;
 
+            const double tick = SnapshotScheduler::GetInstance().GetServerTick();
+
             Active instance;
 
             instance.clip = &iterator->second;
-            instance.speed = speed;
-            instance.time = 0.0f;
-            instance.wrap = wrap;
-            instance.blend = mode;
-            instance.weight = fadeSeconds <= 0.0f ? 1.0f : 0.0f;
-            instance.fadeVelocity = fadeSeconds <= 0.0f ? 0.0f : 1.0f / fadeSeconds;
+            instance.event.clipId = MakeClipId(name);
+            instance.event.startTick = static_cast<std::uint64_t>(tick);
+            instance.event.startTime = -TicksToSeconds(tick - static_cast<double>(instance.event.startTick)) * speed;
+            instance.event.speed = speed;
+            instance.event.fadeIn = std::max(fadeSeconds, 0.0f);
+            instance.event.wrap = wrap;
+            instance.event.blend = mode;
 
             if (fadeSeconds > 0.0f)
             {
                 for (auto& active : activeList)
-                    active.fadeVelocity = -1.0f / fadeSeconds;
+                    StopActive(active, tick, fadeSeconds);
             }
 
             activeList.push_back(instance);
@@ -133,7 +151,7 @@ namespace Blaster::Client::Render
 
             for (const auto& active : activeList)
             {
-                if (active.clip->name == name)
+                if (active.clip && active.clip->name == name && active.event.stopTick == AnimationEvent::kPlaying)
                     return true;
             }
 
@@ -142,10 +160,12 @@ namespace Blaster::Client::Render
 
         void Stop(const std::string& name, float fadeSeconds = 0.0f)
         {
+            const double tick = SnapshotScheduler::GetInstance().GetServerTick();
+
             for (auto& active : activeList)
             {
                 if (active.clip && active.clip->name == name)
-                    active.fadeVelocity = fadeSeconds <= 0.0f ? -1.0f : -1.0f / fadeSeconds;
+                    StopActive(active, tick, fadeSeconds);
             }
 
             Blaster::Independent::ECS::Synchronization::SenderSynchronization::GetInstance().MarkDirty(GetGameObject(), typeid(Animator));
@@ -153,18 +173,27 @@ namespace Blaster::Client::Render
 
         void StopAll(float fadeSeconds = 0.0f)
         {
+            const double tick = SnapshotScheduler::GetInstance().GetServerTick();
+
             for (auto& active : activeList)
-                active.fadeVelocity = fadeSeconds <= 0.0f ? -1.0f : -1.0f / fadeSeconds;
+                StopActive(active, tick, fadeSeconds);
 
             Blaster::Independent::ECS::Synchronization::SenderSynchronization::GetInstance().MarkDirty(GetGameObject(), typeid(Animator));
         }
 
         void SetSpeed(const std::string& name, float speed)
         {
+            const double tick = SnapshotScheduler::GetInstance().GetServerTick();
+
             for (auto& active : activeList)
             {
-                if (active.clip && active.clip->name == name)
-                    active.speed = speed;
+                if (!active.clip || active.clip->name != name)
+                    continue;
+
+                const float elapsed = TicksToSeconds(tick - static_cast<double>(active.event.startTick));
+
+                active.event.startTime += elapsed * (active.event.speed - speed);
+                active.event.speed = speed;
             }
 
             Blaster::Independent::ECS::Synchronization::SenderSynchronization::GetInstance().MarkDirty(GetGameObject(), typeid(Animator));
@@ -172,23 +201,27 @@ namespace Blaster::Client::Render
 
         void Update() override
         {
-            const float dt = Time::GetInstance().GetDeltaTime();
+            const double tick = SnapshotScheduler::GetInstance().GetServerTick();
 
             for (auto& active : activeList)
             {
-                active.time += active.speed * dt;
-                active.weight = std::clamp(active.weight + active.fadeVelocity * dt, 0.0f, 1.0f);
-
-                if (active.clip && active.wrap == WrapMode::LOOP)
-                {
-                    while (active.time > active.clip->durationSeconds)
-                        active.time -= active.clip->durationSeconds;
-                }
+                active.time = SampleTime(active, tick);
+                active.weight = SampleWeight(active.event, tick);
             }
 
-            activeList.erase(std::remove_if(activeList.begin(), activeList.end(), [](const Active& a) { return a.weight <= 0.0f; }), activeList.end());
+            activeList.erase(std::remove_if(activeList.begin(), activeList.end(), [](const Active& a) { return a.weight <= 0.0f && a.event.stopTick != AnimationEvent::kPlaying; }), activeList.end());
+
+            correctionTimer += Time::GetInstance().GetDeltaTime();
+
+            if (correctionTimer >= kCorrectionInterval)
+            {
+                correctionTimer = 0.0f;
+
+                if (!activeList.empty())
+                    SendCorrection(tick);
+            }
 
-            if (activeList.empty())
+            if (activeList.empty() || !skeleton)
                 return;
 
             const size_t boneCount = skeleton->bones.size();
@@ -202,15 +235,15 @@ namespace Blaster::Client::Render
             {
                 const float w = active.weight;
 
-                if (w <= 0.0f)
+                if (w <= 0.0f || !active.clip)
                     continue;
 
                 for (const auto& chan : active.clip->channels)
                 {
-                    const Key samp = SampleChannel(chan, active.time, active.clip->durationSeconds, active.wrap);
+                    const Key samp = SampleChannel(chan, active.time, active.clip->durationSeconds, active.event.wrap);
                     const uint32_t id = chan.boneId;
 
-                    if (active.blend == BlendMode::ADDITIVE)
+                    if (active.event.blend == BlendMode::ADDITIVE)
                     {
                         translations[id] += samp.translation * w;
                         scales[id] += (samp.scale - Vector<float, 3>{1, 1, 1})* w;
@@ -280,53 +313,35 @@ namespace Blaster::Client::Render
         {
             archive & boost::serialization::base_object<Component>(*this);
 
-            std::vector<ActiveNet> activeNetwork;
+            std::vector<AnimationEvent> eventList;
 
-            activeNetwork.reserve(activeList.size());
+            eventList.reserve(activeList.size());
 
             for (const auto& active : activeList)
-            {
-                if (!active.clip)
-                    continue;
-
-                activeNetwork.push_back({ active.clip->name, active.time, active.speed, active.weight, active.fadeVelocity, active.wrap, active.blend });
-            }
-
-            activeNetwork.insert(activeNetwork.end(), pendingNetworkList.begin(), pendingNetworkList.end());
+                eventList.push_back(active.event);
 
-            archive & BOOST_SERIALIZATION_NVP(activeNetwork);
+            archive & BOOST_SERIALIZATION_NVP(eventList);
         }
 
         template <class Archive>
         void load(Archive& archive, const unsigned)
         {
-            std::vector<ActiveNet> activeNetworkList;
+            std::vector<AnimationEvent> eventList;
 
             archive & boost::serialization::base_object<Component>(*this);
 
-            archive & BOOST_SERIALIZATION_NVP(activeNetworkList);
+            archive & BOOST_SERIALIZATION_NVP(eventList);
 
             activeList.clear();
 
-            for (const auto& activeNet : activeNetworkList)
+            for (const auto& event : eventList)
             {
-                auto iterator = clips.find(activeNet.clipName);
-
-                if (iterator == clips.end())
-                {
-                    pendingNetworkList.push_back(activeNet);
-                    continue;
-                }
-
                 Active active;
 
-                active.clip = &iterator->second;
-                active.time = activeNet.time;
-                active.speed = activeNet.speed;
-                active.weight = activeNet.weight;
-                active.fadeVelocity = activeNet.fadeVel;
-                active.wrap = activeNet.wrap;
-                active.blend = activeNet.blend;
+                active.event = event;
+
+                if (const auto iterator = clipIdMap.find(event.clipId); iterator != clipIdMap.end())
+                    active.clip = iterator->second;
 
                 activeList.push_back(active);
             }
@@ -336,49 +351,43 @@ namespace Blaster::Client::Render
 
         void ResolvePending()
         {
-            if (pendingNetworkList.empty())
-                return;
-
-            for (auto iterator = pendingNetworkList.begin(); iterator != pendingNetworkList.end(); )
+            for (auto& active : activeList)
             {
-                auto clipIt = clips.find(iterator->clipName);
-
-                if (clipIt == clips.end())
-                { 
-                    ++iterator;
+                if (active.clip)
                     continue;
-                }
 
-                Active active;
+                if (const auto iterator = clipIdMap.find(active.event.clipId); iterator != clipIdMap.end())
+                    active.clip = iterator->second;
+            }
+        }
+
+        void SendCorrection(const double tick)
+        {
+            for (auto& active : activeList)
+            {
+                if (!active.clip || active.event.wrap != WrapMode::LOOP || active.clip->durationSeconds <= 0.0f)
+                    continue;
 
-                active.clip = &clipIt->second;
-                active.time = iterator->time;
-                active.speed = iterator->speed;
-                active.weight = iterator->weight;
-                active.fadeVelocity = iterator->fadeVel;
-                active.wrap = iterator->wrap;
-                active.blend = iterator->blend;
+                const float unwrapped = active.event.startTime + TicksToSeconds(tick - static_cast<double>(active.event.startTick)) * active.event.speed;
 
-                activeList.push_back(active);
-                iterator = pendingNetworkList.erase(iterator);
+                active.event.startTime -= std::floor(unwrapped / active.clip->durationSeconds) * active.clip->durationSeconds;
             }
+
+            Blaster::Independent::ECS::Synchronization::SenderSynchronization::GetInstance().MarkDirty(GetGameObject(), typeid(Animator));
         }
 
         struct Active
         {
+            AnimationEvent event;
+
             const AnimationClip* clip{ nullptr };
 
             float time{ 0.0f };
-            float speed{ 1.0f };
             float weight{ 1.0f };
-            float fadeVelocity{ 0.0f };
-
-            WrapMode wrap{ WrapMode::LOOP };
-            BlendMode blend{ BlendMode::OVERWRITE };
 
             bool operator==(const Active& other) const
             {
-                return OPERATOR_CHECK(clip, time, speed, weight, fadeVelocity, wrap, blend);
+                return event == other.event;
             }
 
             bool operator!=(const Active& other) const
@@ -387,6 +396,53 @@ namespace Blaster::Client::Render
             }
         };
 
+        static void StopActive(Active& active, const double tick, const float fadeSeconds)
+        {
+            if (active.event.stopTick != AnimationEvent::kPlaying)
+                return;
+
+            active.event.stopTick = static_cast<std::uint64_t>(tick);
+            active.event.fadeOut = fadeSeconds <= 0.0f ? 1.0f : fadeSeconds;
+        }
+
+        static float SampleTime(const Active& active, const double tick)
+        {
+            float time = active.event.startTime + TicksToSeconds(tick - static_cast<double>(active.event.startTick)) * active.event.speed;
+
+            if (active.clip && active.event.wrap == WrapMode::LOOP && active.clip->durationSeconds > 0.0f && time > active.clip->durationSeconds)
+                time = std::fmod(time, active.clip->durationSeconds);
+
+            return time;
+        }
+
+        static float SampleWeight(const AnimationEvent& event, const double tick)
+        {
+            float weight = 1.0f;
+
+            if (event.fadeIn > 0.0f)
+                weight = std::clamp(TicksToSeconds(tick - static_cast<double>(event.startTick)) / event.fadeIn, 0.0f, 1.0f);
+
+            if (event.stopTick != AnimationEvent::kPlaying)
+                weight = std::min(weight, std::clamp(1.0f - TicksToSeconds(tick - static_cast<double>(event.stopTick)) / event.fadeOut, 0.0f, 1.0f));
+
+            return weight;
+        }
+
+        static float TicksToSeconds(const double ticks)
+        {
+            return static_cast<float>(std::max(ticks, 0.0) * SnapshotScheduler::GetTickInterval());
+        }
+
+        static std::uint32_t MakeClipId(const std::string& name)
+        {
+            std::uint32_t hash = 2166136261u;
+
+            for (const char character : name)
+                hash = (hash ^ static_cast<std::uint8_t>(character)) * 16777619u;
+
+            return hash;
+        }
+
         static Vector<float, 4> NormalizeQuat(Vector<float, 4> q)
         {
             const float len = std::sqrt(q.x() * q.x() + q.y() * q.y() + q.z() * q.z() + q.w() * q.w());
@@ -478,18 +534,22 @@ namespace Blaster::Client::Render
             };
         }
 
+        static constexpr float kCorrectionInterval = 2.0f;
+
         Skeleton* skeleton{ nullptr };
 
         std::unordered_map<std::string, AnimationClip> clips;
+        std::unordered_map<std::uint32_t, const AnimationClip*> clipIdMap;
         std::vector<Active> activeList;
-        std::vector<ActiveNet> pendingNetworkList;
+
+        float correctionTimer{ 0.0f };
 
         std::vector<Vector<float, 3>> translations;
         std::vector<Vector<float, 3>> scales;
         std::vector<Vector<float, 4>> rotations;
         std::vector<bool> filled;
 
-        DESCRIBE_AND_REGISTER(Animator, (Component), (), (), (activeList, pendingNetworkList))
+        DESCRIBE_AND_REGISTER(Animator, (Component), (), (), (activeList))
     };
 }
 
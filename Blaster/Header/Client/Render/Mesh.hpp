@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstring>
 #include <vector>
 #include <memory>
 #include <concepts>
@@ -13,6 +14,8 @@
 #include "Client/Render/Vertex.hpp"
 #include "Independent/ECS/Component.hpp"
 #include "Independent/ECS/ComponentFactory.hpp"
+#include "Independent/Thread/MainThreadExecutor.hpp"
+#include "Independent/Utility/AssetCache.hpp"
 
 namespace Blaster::Client::Render
 {
@@ -64,6 +67,8 @@ namespace Blaster::Client::Render
 
         void Initialize() override
         {
+            ResolveGeometry();
+
             if (shouldRegenerate && !GetGameObject()->IsAuthoritative() && GetGameObject()->GetOwningClient().has_value() && GetGameObject()->GetOwningClient().value() != ClientNetwork::GetInstance().GetNetworkId() && !vertices.empty() && !indices.empty())
             {
                 for (auto& buffer : bufferMap | std::views::values)
@@ -118,6 +123,15 @@ namespace Blaster::Client::Render
             renderCallDeque.emplace_back(function);
         }
 
+        void OnAfterMerge() override
+        {
+            MainThreadExecutor::GetInstance().EnqueueTask(nullptr, [lifetime = std::weak_ptr<bool>(lifetimeToken), this]()
+                {
+                    if (!lifetime.expired() && ResolveGeometry())
+                        UploadResolvedGeometry();
+                });
+        }
+
         void Render(const std::shared_ptr<Camera>& camera) override
         {
             if (const auto shader = GetGameObject()->template GetComponent<Shader>())
@@ -207,19 +221,149 @@ namespace Blaster::Client::Render
         friend class boost::serialization::access;
 
         template <typename Archive>
-        void serialize(Archive& archive, const unsigned)
+        void save(Archive& archive, const unsigned) const
+        {
+            archive & boost::serialization::base_object<Component>(*this);
+
+            if (!shouldRegenerate)
+                return;
+
+            const AssetHash publishedGeometryHash = PublishGeometry();
+
+            archive & boost::serialization::make_nvp("geometryHash", publishedGeometryHash);
+
+            archive & boost::serialization::make_nvp("bufferMap", bufferMap);
+        }
+
+        template <typename Archive>
+        void load(Archive& archive, const unsigned)
         {
             archive & boost::serialization::base_object<Component>(*this);
 
             if (!shouldRegenerate)
                 return;
 
-            archive & boost::serialization::make_nvp("vertices", vertices);
-            archive & boost::serialization::make_nvp("indices", indices);
+            archive & boost::serialization::make_nvp("geometryHash", geometryHash);
 
             archive & boost::serialization::make_nvp("bufferMap", bufferMap);
         }
 
+        BOOST_SERIALIZATION_SPLIT_MEMBER()
+
+        bool ResolveGeometry()
+        {
+            if (geometryHash == AssetHash{} || geometryHash == resolvedGeometryHash)
+                return false;
+
+            resolvedGeometryHash = geometryHash;
+
+            if (const auto geometry = AssetCache::GetInstance().Find(geometryHash); geometry.has_value())
+                return DecodeGeometry(geometry.value());
+
+            AssetCache::GetInstance().Require(geometryHash, [lifetime = std::weak_ptr<bool>(lifetimeToken), this, hash = geometryHash](const std::string& geometry)
+                {
+                    MainThreadExecutor::GetInstance().EnqueueTask(nullptr, [lifetime, this, hash, geometry]()
+                        {
+                            if (lifetime.expired() || hash != geometryHash || !DecodeGeometry(geometry))
+                                return;
+
+                            UploadResolvedGeometry();
+                        });
+                });
+
+            return false;
+        }
+
+        void UploadResolvedGeometry()
+        {
+            if (VAO == 0)
+            {
+                if (GetGameObject())
+                    Initialize();
+            }
+            else
+                areVerticesDirty = areVerticesResized = areIndicesDirty = areIndicesResized = true;
+        }
+
+        AssetHash PublishGeometry() const
+        {
+            if (vertices.empty() && indices.empty())
+                return {};
+
+            std::string geometry = EncodeGeometry();
+
+            const AssetHash hash = AssetCache::HashBytes(geometry);
+
+            if (hash == publishedHash)
+                return hash;
+
+            publishedHash = hash;
+
+            AssetCache::GetInstance().Publish(hash, [lifetime = std::weak_ptr<bool>(lifetimeToken), this]() -> std::optional<std::string>
+                {
+                    if (lifetime.expired())
+                        return std::nullopt;
+
+                    return EncodeGeometry();
+                });
+
+            return hash;
+        }
+
+        std::string EncodeGeometry() const
+        {
+            const auto vertexCount = static_cast<std::uint32_t>(vertices.size());
+            const auto indexCount = static_cast<std::uint32_t>(indices.size());
+
+            std::string result(sizeof(vertexCount) + sizeof(indexCount) + vertices.size() * sizeof(T) + indices.size() * sizeof(uint32_t), '\0');
+
+            char* cursor = result.data();
+
+            std::memcpy(cursor, &vertexCount, sizeof(vertexCount));
+            cursor += sizeof(vertexCount);
+
+            std::memcpy(cursor, &indexCount, sizeof(indexCount));
+            cursor += sizeof(indexCount);
+
+            std::memcpy(cursor, vertices.data(), vertices.size() * sizeof(T));
+            cursor += vertices.size() * sizeof(T);
+
+            std::memcpy(cursor, indices.data(), indices.size() * sizeof(uint32_t));
+
+            return result;
+        }
+
+        bool DecodeGeometry(const std::string& geometry)
+        {
+            std::uint32_t vertexCount = 0;
+            std::uint32_t indexCount = 0;
+
+            if (geometry.size() < sizeof(vertexCount) + sizeof(indexCount))
+                return false;
+
+            std::memcpy(&vertexCount, geometry.data(), sizeof(vertexCount));
+            std::memcpy(&indexCount, geometry.data() + sizeof(vertexCount), sizeof(indexCount));
+
+            const std::size_t vertexBytes = static_cast<std::size_t>(vertexCount) * sizeof(T);
+            const std::size_t indexBytes = static_cast<std::size_t>(indexCount) * sizeof(uint32_t);
+
+            if (geometry.size() != sizeof(vertexCount) + sizeof(indexCount) + vertexBytes + indexBytes)
+            {
+                std::cerr << "Mesh geometry has an unexpected size '" << geometry.size() << "'." << std::endl;
+                return false;
+            }
+
+            const char* cursor = geometry.data() + sizeof(vertexCount) + sizeof(indexCount);
+
+            vertices.resize(vertexCount);
+            indices.resize(indexCount);
+
+            std::memcpy(vertices.data(), cursor, vertexBytes);
+            std::memcpy(indices.data(), cursor + vertexBytes, indexBytes);
+
+            return true;
+        }
+
         void CommitIfDirty()
         {
             if (!areVerticesDirty && !areIndicesDirty)
@@ -323,12 +467,19 @@ namespace Blaster::Client::Render
 
         bool shouldRegenerate = true;
 
+        mutable AssetHash publishedHash{};
+
+        AssetHash geometryHash{};
+        AssetHash resolvedGeometryHash{};
+
+        std::shared_ptr<bool> lifetimeToken{ std::make_shared<bool>(true) };
+
         bool areVerticesDirty = false, areIndicesDirty = false;
         bool areVerticesResized = false, areIndicesResized = false;
 
         size_t firstVerticeDirty = std::numeric_limits<size_t>::max(), lastVerticeDirty = 0;
         size_t firstIndiceDirty = std::numeric_limits<size_t>::max(), lastIndiceDirty = 0;
 
-        DESCRIBE_AND_REGISTER(Mesh<T>, (Component), (), (), (shouldRegenerate, areVerticesDirty, areIndicesDirty, areVerticesResized, areIndicesResized, firstVerticeDirty, lastVerticeDirty, firstIndiceDirty, lastIndiceDirty))
+        DESCRIBE_AND_REGISTER(Mesh<T>, (Component), (), (), (shouldRegenerate, geometryHash, areVerticesDirty, areIndicesDirty, areVerticesResized, areIndicesResized, firstVerticeDirty, lastVerticeDirty, firstIndiceDirty, lastIndiceDirty))
     };
 }
\ No newline at end of file
@@ -46,6 +46,9 @@ namespace Blaster::Client::Render
 
     public:
 
+        static constexpr bool TracksDescribedFields = true;
+        static constexpr bool VersionsDescribedFields = true;
+
         Model(const Model&) = delete;
         Model(Model&&) = delete;
         Model& operator=(const Model&) = delete;
@@ -153,6 +156,9 @@ namespace Blaster::Client::Render
             archive & BOOST_SERIALIZATION_NVP(path);
             archive & BOOST_SERIALIZATION_NVP(buildCollider);
             archive & BOOST_SERIALIZATION_NVP(hasBones);
+
+            if constexpr (Archive::is_loading::value)
+                BumpFieldVersion();
         }
 
         void LoadModel()
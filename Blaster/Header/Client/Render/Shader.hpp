@@ -2,13 +2,17 @@
 
 #include <memory>
 #include <glad/glad.h>
+#include <boost/serialization/array.hpp>
 #include "Independent/ComponentRegistry.hpp"
 #include "Independent/ECS/GameObject.hpp"
 #include "Independent/ECS/ComponentFactory.hpp"
+#include "Independent/Thread/MainThreadExecutor.hpp"
+#include "Independent/Utility/AssetCache.hpp"
 #include "Independent/Utility/AssetPath.hpp"
 #include "Independent/Utility/FileHelper.hpp"
 
 using namespace Blaster::Independent::ECS;
+using namespace Blaster::Independent::Thread;
 using namespace Blaster::Independent::Utility;
 
 namespace Blaster::Client::Render
@@ -18,6 +22,10 @@ namespace Blaster::Client::Render
 
 	public:
 
+		static constexpr bool TracksDescribedFields = true;
+		static constexpr bool VersionsDescribedFields = true;
+		static constexpr bool DeserializesOnMainThread = true;
+
 		Shader(const Shader&) = delete;
 		Shader(Shader&&) = delete;
 		Shader& operator=(const Shader&) = delete;
@@ -89,6 +97,15 @@ namespace Blaster::Client::Render
 			glUniformMatrix4fv(location, count, GL_FALSE, reinterpret_cast<const GLfloat*>(&data[0][0]));
 		}
 
+		void OnAfterMerge() override
+		{
+			MainThreadExecutor::GetInstance().EnqueueTask(nullptr, [lifetime = std::weak_ptr<bool>(lifetimeToken), this]()
+				{
+					if (!lifetime.expired())
+						ResolveSources();
+				});
+		}
+
 		[[nodiscard]]
 		std::string GetName() const
 		{
@@ -105,6 +122,8 @@ namespace Blaster::Client::Render
 			result->fragmentPath = { { localPath.GetDomain() }, std::format("{}Fragment.glsl", localPath.GetLocalPath()) };
 			result->vertexData = FileHelper::ReadFile(result->vertexPath);
 			result->fragmentData = FileHelper::ReadFile(result->fragmentPath);
+			result->vertexHash = result->resolvedVertexHash = AssetCache::GetInstance().HashFile(result->vertexPath);
+			result->fragmentHash = result->resolvedFragmentHash = AssetCache::GetInstance().HashFile(result->fragmentPath);
 
 			result->Generate();
 
@@ -199,21 +218,82 @@ namespace Blaster::Client::Render
 			isGenerated = true;
 		}
 
+		void ResolveSources()
+		{
+			if (vertexHash == resolvedVertexHash && fragmentHash == resolvedFragmentHash)
+				return;
+
+			std::optional<std::string> vertex = AssetCache::GetInstance().Resolve(vertexPath, vertexHash);
+			std::optional<std::string> fragment = AssetCache::GetInstance().Resolve(fragmentPath, fragmentHash);
+
+			if (!vertex.has_value() || !fragment.has_value())
+			{
+				if (!vertex.has_value())
+					RequireSource(vertexHash);
+
+				if (!fragment.has_value())
+					RequireSource(fragmentHash);
+
+				return;
+			}
+
+			vertexData = std::move(vertex.value());
+			fragmentData = std::move(fragment.value());
+
+			resolvedVertexHash = vertexHash;
+			resolvedFragmentHash = fragmentHash;
+
+#ifndef IS_SERVER
+			isGenerated = false;
+
+			Generate();
+#endif
+		}
+
+		void RequireSource(const AssetHash& hash)
+		{
+			AssetCache::GetInstance().Require(hash, [lifetime = std::weak_ptr<bool>(lifetimeToken), this](const std::string&)
+				{
+					MainThreadExecutor::GetInstance().EnqueueTask(nullptr, [lifetime, this]()
+						{
+							if (!lifetime.expired())
+								ResolveSources();
+						});
+				});
+		}
+
 		template <class Archive>
-		void serialize(Archive& archive, const unsigned)
+		void save(Archive& archive, const unsigned) const
 		{
 			archive & boost::serialization::base_object<Component>(*this);
 
-			archive & boost::serialization::make_nvp("id", id);
 			archive & boost::serialization::make_nvp("name", name);
 			archive & boost::serialization::make_nvp("localPath", localPath);
-			archive & boost::serialization::make_nvp("isGenerated", isGenerated);
 			archive & boost::serialization::make_nvp("vertexPath", vertexPath);
 			archive & boost::serialization::make_nvp("fragmentPath", fragmentPath);
-			archive & boost::serialization::make_nvp("vertexData", vertexData);
-			archive & boost::serialization::make_nvp("fragmentData", fragmentData);
+			archive & boost::serialization::make_nvp("vertexHash", vertexHash);
+			archive & boost::serialization::make_nvp("fragmentHash", fragmentHash);
 		}
 
+		template <class Archive>
+		void load(Archive& archive, const unsigned)
+		{
+			archive & boost::serialization::base_object<Component>(*this);
+
+			archive & boost::serialization::make_nvp("name", name);
+			archive & boost::serialization::make_nvp("localPath", localPath);
+			archive & boost::serialization::make_nvp("vertexPath", vertexPath);
+			archive & boost::serialization::make_nvp("fragmentPath", fragmentPath);
+			archive & boost::serialization::make_nvp("vertexHash", vertexHash);
+			archive & boost::serialization::make_nvp("fragmentHash", fragmentHash);
+
+			BumpFieldVersion();
+
+			ResolveSources();
+		}
+
+		BOOST_SERIALIZATION_SPLIT_MEMBER()
+
 		unsigned int id { 0 };
 
 		std::string name;
@@ -225,7 +305,12 @@ namespace Blaster::Client::Render
 		AssetPath vertexPath, fragmentPath;
 		std::string vertexData, fragmentData;
 
-		DESCRIBE_AND_REGISTER(Shader, (Component), (), (), (id, name, localPath, isGenerated, vertexPath, fragmentPath, vertexData, fragmentData))
+		AssetHash vertexHash{}, fragmentHash{};
+		AssetHash resolvedVertexHash{}, resolvedFragmentHash{};
+
+		std::shared_ptr<bool> lifetimeToken{ std::make_shared<bool>(true) };
+
+		DESCRIBE_AND_REGISTER(Shader, (Component), (), (), (name, localPath, vertexPath, fragmentPath, vertexHash, fragmentHash))
 
 	};
 }
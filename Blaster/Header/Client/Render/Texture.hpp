@@ -22,6 +22,8 @@ namespace Blaster::Client::Render
 
     public:
 
+        static constexpr bool DeserializesOnMainThread = true;
+
         Texture(const Texture&) = delete;
         Texture(Texture&&) = delete;
         Texture& operator=(const Texture&) = delete;
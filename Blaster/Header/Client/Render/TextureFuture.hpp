@@ -9,6 +9,9 @@ namespace Blaster::Client::Render
 
     public:
 
+        static constexpr bool TracksDescribedFields = true;
+        static constexpr bool VersionsDescribedFields = true;
+
         TextureFuture(const TextureFuture&) = delete;
         TextureFuture(TextureFuture&&) = delete;
         TextureFuture& operator=(const TextureFuture&) = delete;
@@ -43,6 +46,9 @@ namespace Blaster::Client::Render
             archive & boost::serialization::base_object<Component>(*this);
 
             archive & BOOST_SERIALIZATION_NVP(path);
+
+            if constexpr (Archive::is_loading::value)
+                BumpFieldVersion();
         }
 
         std::string path;
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Independent/Math/Vector.hpp"
+#include "Independent/Utility/AssetPath.hpp"
+
+namespace Blaster::Independent::ECS
+{
+    template <class Type, class = void>
+    struct BinaryField;
+
+    template <class Type>
+    struct BinaryField<Type, std::enable_if_t<std::is_arithmetic_v<Type> || std::is_enum_v<Type>>>
+    {
+        static void Write(std::vector<std::uint8_t>& buffer, const Type& value)
+        {
+            const auto* bytes = reinterpret_cast<const std::uint8_t*>(&value);
+
+            buffer.insert(buffer.end(), bytes, bytes + sizeof(Type));
+        }
+
+        static bool Read(const std::span<const std::uint8_t> bytes, std::size_t& offset, Type& value)
+        {
+            if (offset + sizeof(Type) > bytes.size())
+                return false;
+
+            std::memcpy(&value, bytes.data() + offset, sizeof(Type));
+
+            offset += sizeof(Type);
+
+            return true;
+        }
+    };
+
+    template <>
+    struct BinaryField<std::string>
+    {
+        static void Write(std::vector<std::uint8_t>& buffer, const std::string& value)
+        {
+            BinaryField<std::uint32_t>::Write(buffer, static_cast<std::uint32_t>(value.size()));
+
+            buffer.insert(buffer.end(), value.begin(), value.end());
+        }
+
+        static bool Read(const std::span<const std::uint8_t> bytes, std::size_t& offset, std::string& value)
+        {
+            std::uint32_t length = 0;
+
+            if (!BinaryField<std::uint32_t>::Read(bytes, offset, length) || offset + length > bytes.size())
+                return false;
+
+            value.assign(reinterpret_cast<const char*>(bytes.data() + offset), length);
+
+            offset += length;
+
+            return true;
+        }
+    };
+
+    template <class Element, std::size_t N>
+    struct BinaryField<Blaster::Independent::Math::Vector<Element, N>>
+    {
+        static void Write(std::vector<std::uint8_t>& buffer, const Blaster::Independent::Math::Vector<Element, N>& value)
+        {
+            for (std::size_t i = 0; i < N; ++i)
+                BinaryField<Element>::Write(buffer, value[i]);
+        }
+
+        static bool Read(const std::span<const std::uint8_t> bytes, std::size_t& offset, Blaster::Independent::Math::Vector<Element, N>& value)
+        {
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                if (!BinaryField<Element>::Read(bytes, offset, value[i]))
+                    return false;
+            }
+
+            return true;
+        }
+    };
+
+    template <class Element>
+    struct BinaryField<std::vector<Element>, std::void_t<decltype(BinaryField<Element>::Write)>>
+    {
+        static void Write(std::vector<std::uint8_t>& buffer, const std::vector<Element>& value)
+        {
+            BinaryField<std::uint32_t>::Write(buffer, static_cast<std::uint32_t>(value.size()));
+
+            for (const Element& element : value)
+                BinaryField<Element>::Write(buffer, element);
+        }
+
+        static bool Read(const std::span<const std::uint8_t> bytes, std::size_t& offset, std::vector<Element>& value)
+        {
+            std::uint32_t count = 0;
+
+            if (!BinaryField<std::uint32_t>::Read(bytes, offset, count) || count > bytes.size() - offset)
+                return false;
+
+            value.resize(count);
+
+            for (Element& element : value)
+            {
+                if (!BinaryField<Element>::Read(bytes, offset, element))
+                    return false;
+            }
+
+            return true;
+        }
+    };
+
+    template <class Element, std::size_t N>
+    struct BinaryField<std::array<Element, N>, std::void_t<decltype(BinaryField<Element>::Write)>>
+    {
+        static void Write(std::vector<std::uint8_t>& buffer, const std::array<Element, N>& value)
+        {
+            for (const Element& element : value)
+                BinaryField<Element>::Write(buffer, element);
+        }
+
+        static bool Read(const std::span<const std::uint8_t> bytes, std::size_t& offset, std::array<Element, N>& value)
+        {
+            for (Element& element : value)
+            {
+                if (!BinaryField<Element>::Read(bytes, offset, element))
+                    return false;
+            }
+
+            return true;
+        }
+    };
+
+    template <>
+    struct BinaryField<Blaster::Independent::Utility::AssetPath>
+    {
+        static void Write(std::vector<std::uint8_t>& buffer, const Blaster::Independent::Utility::AssetPath& value)
+        {
+            BinaryField<std::string>::Write(buffer, value.GetDomain());
+            BinaryField<std::string>::Write(buffer, value.GetLocalPath());
+        }
+
+        static bool Read(const std::span<const std::uint8_t> bytes, std::size_t& offset, Blaster::Independent::Utility::AssetPath& value)
+        {
+            std::string domain;
+            std::string localPath;
+
+            if (!BinaryField<std::string>::Read(bytes, offset, domain) || !BinaryField<std::string>::Read(bytes, offset, localPath))
+                return false;
+
+            value = { std::move(domain), std::move(localPath) };
+
+            return true;
+        }
+    };
+
+    template <class Type, class = void>
+    struct HasBinaryField : std::false_type {};
+
+    template <class Type>
+    struct HasBinaryField<Type, std::void_t<decltype(BinaryField<Type>::Write)>> : std::true_type {};
+}
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -35,6 +36,7 @@ namespace Blaster::Independent::ECS
     namespace Synchronization
     {
         class ReceiverSynchronization;
+        class SenderSynchronization;
     }
 
     [[nodiscard]]
@@ -104,6 +106,17 @@ namespace Blaster::Independent::ECS
             wasRemoved = false;
         }
 
+        [[nodiscard]]
+        std::uint64_t GetFieldVersion() const noexcept
+        {
+            return fieldVersion;
+        }
+
+        void BumpFieldVersion() noexcept
+        {
+            ++fieldVersion;
+        }
+
         virtual void OnAfterMerge() { }
 
         virtual void Initialize() { }
@@ -126,6 +139,7 @@ namespace Blaster::Independent::ECS
 
         friend class Blaster::Independent::ECS::GameObject;
         friend class Blaster::Independent::ECS::Synchronization::ReceiverSynchronization;
+        friend class Blaster::Independent::ECS::Synchronization::SenderSynchronization;
 
         static const std::string& CachedName(const std::type_info& typeInformation)
         {
@@ -147,6 +161,10 @@ namespace Blaster::Independent::ECS
         bool wasAdded = false;
         bool wasRemoved = false;
 
+        std::atomic<std::uint64_t> dirtyEpoch = 0;
+
+        std::uint64_t fieldVersion = 0;
+
         friend class boost::serialization::access;
 
         template <class Archive>
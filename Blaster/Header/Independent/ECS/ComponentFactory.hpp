@@ -3,10 +3,17 @@
 #include <string>
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
 #include <functional>
 #include <mutex>
+#include <optional>
+#include <span>
+#include <vector>
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/text_oarchive.hpp>
 #include <boost/serialization/shared_ptr.hpp>
 #include "Independent/ECS/Component.hpp"
+#include "Independent/ECS/DescribedCodec.hpp"
 #include "Independent/Utility/TypeRegistrar.hpp"
 
 namespace Blaster::Independent::ECS
@@ -17,6 +24,10 @@ namespace Blaster::Independent::ECS
     public:
 
         using Creator = std::function<std::shared_ptr<Component>()>;
+        using Loader = void(*)(boost::archive::text_iarchive&, Component&);
+        using Saver = void(*)(boost::archive::text_oarchive&, const Component&);
+        using BinarySaver = std::vector<std::uint8_t>(*)(const Component&);
+        using BinaryLoader = bool(*)(std::span<const std::uint8_t>, Component&);
 
         template <typename T>
         static void Register()
@@ -29,6 +40,42 @@ namespace Blaster::Independent::ECS
             {
                 return std::static_pointer_cast<Component>(std::shared_ptr<T>(new T()));
             };
+
+            GetLoaderRegistry()[key] = [](boost::archive::text_iarchive& archive, Component& component)
+            {
+                archive >> static_cast<T&>(component);
+            };
+
+            GetSaverRegistry()[key] = [](boost::archive::text_oarchive& archive, const Component& component)
+            {
+                archive << static_cast<const T&>(component);
+            };
+
+            if constexpr (UsesDescribedCodec<T>)
+            {
+                GetBinarySaverRegistry()[key] = [](const Component& component)
+                {
+                    return DescribedCodec<T>::Encode(static_cast<const T&>(component), DescribedCodec<T>::ReplicatedMask);
+                };
+
+                GetBinaryLoaderRegistry()[key] = [](const std::span<const std::uint8_t> bytes, Component& component)
+                {
+                    return DescribedCodec<T>::Decode(static_cast<T&>(component), DescribedCodec<T>::ReplicatedMask, bytes);
+                };
+            }
+
+            if constexpr (requires { T::DeserializesOnMainThread; })
+            {
+                if (T::DeserializesOnMainThread)
+                    GetMainThreadSet().insert(key);
+            }
+        }
+
+        static bool DeserializesOnMainThread(const std::uint64_t& id)
+        {
+            std::lock_guard guard(GetMutex());
+
+            return GetMainThreadSet().contains(id);
         }
 
         static std::shared_ptr<Component> Instantiate(const std::uint64_t& id)
@@ -44,8 +91,112 @@ namespace Blaster::Independent::ECS
             return iterator->second();
         }
 
+        static bool Load(const std::uint64_t& id, boost::archive::text_iarchive& archive, Component& component)
+        {
+            Loader loader;
+
+            {
+                std::lock_guard guard(GetMutex());
+
+                const auto iterator = GetLoaderRegistry().find(id);
+
+                if (iterator == GetLoaderRegistry().end())
+                    return false;
+
+                loader = iterator->second;
+            }
+
+            loader(archive, component);
+
+            return true;
+        }
+
+        static bool Save(const std::uint64_t& id, boost::archive::text_oarchive& archive, const Component& component)
+        {
+            Saver saver;
+
+            {
+                std::lock_guard guard(GetMutex());
+
+                const auto iterator = GetSaverRegistry().find(id);
+
+                if (iterator == GetSaverRegistry().end())
+                    return false;
+
+                saver = iterator->second;
+            }
+
+            saver(archive, component);
+
+            return true;
+        }
+
+        static std::optional<std::vector<std::uint8_t>> SaveBinary(const std::uint64_t& id, const Component& component)
+        {
+            BinarySaver saver;
+
+            {
+                std::lock_guard guard(GetMutex());
+
+                const auto iterator = GetBinarySaverRegistry().find(id);
+
+                if (iterator == GetBinarySaverRegistry().end())
+                    return std::nullopt;
+
+                saver = iterator->second;
+            }
+
+            return saver(component);
+        }
+
+        static std::optional<bool> LoadBinary(const std::uint64_t& id, const std::span<const std::uint8_t> bytes, Component& component)
+        {
+            BinaryLoader loader;
+
+            {
+                std::lock_guard guard(GetMutex());
+
+                const auto iterator = GetBinaryLoaderRegistry().find(id);
+
+                if (iterator == GetBinaryLoaderRegistry().end())
+                    return std::nullopt;
+
+                loader = iterator->second;
+            }
+
+            return loader(bytes, component);
+        }
+
     private:
 
+        static std::unordered_map<std::uint64_t, BinarySaver>& GetBinarySaverRegistry()
+        {
+            static std::unordered_map<std::uint64_t, BinarySaver> registry;
+
+            return registry;
+        }
+
+        static std::unordered_map<std::uint64_t, BinaryLoader>& GetBinaryLoaderRegistry()
+        {
+            static std::unordered_map<std::uint64_t, BinaryLoader> registry;
+
+            return registry;
+        }
+
+        static std::unordered_map<std::uint64_t, Loader>& GetLoaderRegistry()
+        {
+            static std::unordered_map<std::uint64_t, Loader> registry;
+
+            return registry;
+        }
+
+        static std::unordered_map<std::uint64_t, Saver>& GetSaverRegistry()
+        {
+            static std::unordered_map<std::uint64_t, Saver> registry;
+
+            return registry;
+        }
+
         static std::unordered_map<std::uint64_t, Creator>& GetRegistry()
         {
             static std::unordered_map<std::uint64_t, Creator> registry;
@@ -53,6 +204,13 @@ namespace Blaster::Independent::ECS
             return registry;
         }
 
+        static std::unordered_set<std::uint64_t>& GetMainThreadSet()
+        {
+            static std::unordered_set<std::uint64_t> set;
+
+            return set;
+        }
+
         static std::mutex& GetMutex()
         {
             static std::mutex mutex;
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "Independent/ECS/ComponentFactory.hpp"
+
+namespace Blaster::Independent::ECS
+{
+    class ComponentPool final
+    {
+
+    public:
+
+        ComponentPool(const ComponentPool&) = delete;
+        ComponentPool(ComponentPool&&) = delete;
+        ComponentPool& operator=(const ComponentPool&) = delete;
+        ComponentPool& operator=(ComponentPool&&) = delete;
+
+        std::shared_ptr<Component> Acquire(const std::uint64_t id)
+        {
+            {
+                std::lock_guard guard(mutex);
+
+                if (const auto hit = freeMap.find(id); hit != freeMap.end() && !hit->second.empty())
+                {
+                    std::shared_ptr<Component> result = std::move(hit->second.back());
+
+                    hit->second.pop_back();
+
+                    return result;
+                }
+            }
+
+            return ComponentFactory::Instantiate(id);
+        }
+
+        void Release(const std::uint64_t id, std::shared_ptr<Component> component)
+        {
+            if (!component || component.use_count() != 1)
+                return;
+
+            std::lock_guard guard(mutex);
+
+            std::vector<std::shared_ptr<Component>>& freeList = freeMap[id];
+
+            if (freeList.size() < kMaximumFreePerType)
+                freeList.push_back(std::move(component));
+        }
+
+        static ComponentPool& GetInstance()
+        {
+            std::call_once(initializationFlag, [&]()
+            {
+                instance = std::unique_ptr<ComponentPool>(new ComponentPool());
+            });
+
+            return *instance;
+        }
+
+    private:
+
+        ComponentPool() = default;
+
+        static constexpr std::size_t kMaximumFreePerType = 64;
+
+        std::unordered_map<std::uint64_t, std::vector<std::shared_ptr<Component>>> freeMap;
+
+        std::mutex mutex;
+
+        static std::once_flag initializationFlag;
+        static std::unique_ptr<ComponentPool> instance;
+
+    };
+
+    std::once_flag ComponentPool::initializationFlag;
+    std::unique_ptr<ComponentPool> ComponentPool::instance;
+}
\ No newline at end of file
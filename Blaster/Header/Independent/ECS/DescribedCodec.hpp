@@ -0,0 +1,318 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <variant>
+#include <vector>
+#include <boost/serialization/base_object.hpp>
+#include <boost/serialization/vector.hpp>
+#include "Independent/ECS/BinaryField.hpp"
+#include "Independent/ECS/MergeSupport.hpp"
+
+namespace Blaster::Independent::ECS
+{
+    class Component;
+
+    enum class FieldReplication : std::uint8_t
+    {
+        Replicated,
+        NotReplicated,
+        Quantized
+    };
+
+    struct FieldAttribute
+    {
+        std::string_view name;
+
+        FieldReplication replication = FieldReplication::Replicated;
+
+        float minimum = 0.0f;
+        float maximum = 0.0f;
+        float precision = 0.0f;
+
+        static constexpr FieldAttribute Skip(const std::string_view name)
+        {
+            return { name, FieldReplication::NotReplicated };
+        }
+
+        static constexpr FieldAttribute Quantize(const std::string_view name, const float minimum, const float maximum, const float precision)
+        {
+            return { name, FieldReplication::Quantized, minimum, maximum, precision };
+        }
+    };
+
+    template <float Minimum, float Maximum, float Precision>
+    struct QuantizedField
+    {
+        static_assert(Precision > 0.0f && Maximum > Minimum, "Quantized fields need a positive precision and a non-empty range");
+
+        using Step = std::conditional_t<(Maximum - Minimum) / Precision < 65535.0f, std::uint16_t, std::uint32_t>;
+
+        static Step ToStep(const float value)
+        {
+            const float clamped = std::clamp(value, Minimum, Maximum);
+
+            return static_cast<Step>(std::lround((clamped - Minimum) / Precision));
+        }
+
+        static float FromStep(const Step step)
+        {
+            return Minimum + static_cast<float>(step) * Precision;
+        }
+
+        static void Write(std::vector<std::uint8_t>& buffer, const float value)
+        {
+            BinaryField<Step>::Write(buffer, ToStep(value));
+        }
+
+        template <std::size_t N>
+        static void Write(std::vector<std::uint8_t>& buffer, const Blaster::Independent::Math::Vector<float, N>& value)
+        {
+            for (std::size_t i = 0; i < N; ++i)
+                Write(buffer, value[i]);
+        }
+
+        static bool Read(const std::span<const std::uint8_t> bytes, std::size_t& offset, float& value)
+        {
+            Step step = 0;
+
+            if (!BinaryField<Step>::Read(bytes, offset, step))
+                return false;
+
+            value = FromStep(step);
+
+            return true;
+        }
+
+        template <std::size_t N>
+        static bool Read(const std::span<const std::uint8_t> bytes, std::size_t& offset, Blaster::Independent::Math::Vector<float, N>& value)
+        {
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                if (!Read(bytes, offset, value[i]))
+                    return false;
+            }
+
+            return true;
+        }
+
+        static bool Equal(const float a, const float b)
+        {
+            return ToStep(a) == ToStep(b);
+        }
+
+        template <std::size_t N>
+        static bool Equal(const Blaster::Independent::Math::Vector<float, N>& a, const Blaster::Independent::Math::Vector<float, N>& b)
+        {
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                if (!Equal(a[i], b[i]))
+                    return false;
+            }
+
+            return true;
+        }
+    };
+
+    template <class T, std::size_t I>
+    constexpr FieldAttribute DescribedFieldAttribute()
+    {
+        using Descriptor = typename UnwrapDescriptor<boost::mp11::mp_at_c<DescribedMembers<T>, I>>::type;
+
+        if constexpr (requires { T::FieldAttributes; })
+        {
+            for (const FieldAttribute& attribute : T::FieldAttributes)
+            {
+                if (attribute.name == std::string_view(Descriptor::name))
+                    return attribute;
+            }
+        }
+
+        return { Descriptor::name };
+    }
+
+    template <class T>
+    constexpr std::uint64_t DescribedReplicatedMask()
+    {
+        std::uint64_t result = 0;
+
+        boost::mp11::mp_for_each<boost::mp11::mp_iota_c<boost::mp11::mp_size<DescribedMembers<T>>::value>>([&](auto I)
+            {
+                if constexpr (DescribedFieldAttribute<T, I>().replication != FieldReplication::NotReplicated)
+                {
+                    static_assert(HasBinaryField<DescribedFieldType<T, boost::mp11::mp_at_c<DescribedMembers<T>, I>>>::value, "Replicated described field has no binary encoding; mark it FieldAttribute::Skip");
+
+                    result |= std::uint64_t{ 1 } << I;
+                }
+            });
+
+        return result;
+    }
+
+    template <class T>
+    struct DescribedCodec
+    {
+        using Members = DescribedMembers<T>;
+
+        static constexpr std::size_t FieldCount = boost::mp11::mp_size<Members>::value;
+
+        static_assert(FieldCount <= 64, "Described codecs support at most 64 described fields");
+
+        static constexpr std::uint64_t ReplicatedMask = DescribedReplicatedMask<T>();
+
+        template <std::size_t I>
+        using FieldType = DescribedFieldType<T, boost::mp11::mp_at_c<Members, I>>;
+
+        static std::vector<std::uint8_t> Encode(const T& value, const std::uint64_t mask)
+        {
+            std::vector<std::uint8_t> result;
+
+            ForEachReplicated(mask, [&](auto I)
+                {
+                    const auto& field = value.*DescriptorPointer<boost::mp11::mp_at_c<Members, I>>();
+
+                    if constexpr (DescribedFieldAttribute<T, I>().replication == FieldReplication::Quantized)
+                        QuantizedField<DescribedFieldAttribute<T, I>().minimum, DescribedFieldAttribute<T, I>().maximum, DescribedFieldAttribute<T, I>().precision>::Write(result, field);
+                    else
+                        BinaryField<FieldType<I>>::Write(result, field);
+                });
+
+            return result;
+        }
+
+        static bool Decode(T& value, const std::uint64_t mask, const std::span<const std::uint8_t> bytes)
+        {
+            std::size_t offset = 0;
+
+            bool valid = true;
+
+            ForEachReplicated(mask, [&](auto I)
+                {
+                    if (!valid)
+                        return;
+
+                    FieldType<I> decoded{};
+
+                    if constexpr (DescribedFieldAttribute<T, I>().replication == FieldReplication::Quantized)
+                        valid = QuantizedField<DescribedFieldAttribute<T, I>().minimum, DescribedFieldAttribute<T, I>().maximum, DescribedFieldAttribute<T, I>().precision>::Read(bytes, offset, decoded);
+                    else
+                        valid = BinaryField<FieldType<I>>::Read(bytes, offset, decoded);
+
+                    if (valid)
+                        value.*DescriptorPointer<boost::mp11::mp_at_c<Members, I>>() = std::move(decoded);
+                });
+
+            return valid && offset == bytes.size();
+        }
+
+        static std::uint64_t Hash(const T& value)
+        {
+            std::uint64_t hash = 1469598103934665603ull;
+
+            for (const std::uint8_t byte : Encode(value, ReplicatedMask))
+                hash = (hash ^ byte) * 1099511628211ull;
+
+            return hash;
+        }
+
+        static std::uint64_t Diff(const void* component, std::shared_ptr<void>& shadow)
+        {
+            const T& current = *static_cast<const T*>(component);
+
+            const bool fresh = shadow == nullptr;
+
+            if (fresh)
+                shadow = std::make_shared<Shadow>();
+
+            Shadow& last = *static_cast<Shadow*>(shadow.get());
+
+            std::uint64_t mask = 0;
+
+            ForEachReplicated(ReplicatedMask, [&](auto I)
+                {
+                    auto& slot = std::get<I>(last);
+
+                    const auto& value = current.*DescriptorPointer<boost::mp11::mp_at_c<Members, I>>();
+
+                    bool equal;
+
+                    if constexpr (DescribedFieldAttribute<T, I>().replication == FieldReplication::Quantized)
+                        equal = QuantizedField<DescribedFieldAttribute<T, I>().minimum, DescribedFieldAttribute<T, I>().maximum, DescribedFieldAttribute<T, I>().precision>::Equal(slot, value);
+                    else
+                        equal = slot == value;
+
+                    if (fresh || !equal)
+                    {
+                        slot = value;
+                        mask |= std::uint64_t{ 1 } << I;
+                    }
+                });
+
+            return mask;
+        }
+
+        static std::vector<std::uint8_t> EncodeFields(const void* component, const std::uint64_t mask)
+        {
+            return Encode(*static_cast<const T*>(component), mask);
+        }
+
+        static bool ApplyFields(void* component, const std::uint64_t mask, const std::span<const std::uint8_t> bytes)
+        {
+            T& destination = *static_cast<T*>(component);
+
+            if (!Decode(destination, mask, bytes))
+            {
+                std::cerr << "Failed to decode described fields for mask '" << mask << "'." << std::endl;
+                return false;
+            }
+
+            destination.OnAfterMerge();
+
+            return true;
+        }
+
+        template <class Archive>
+        static void Serialize(Archive& archive, T& value)
+        {
+            ForEachReplicated(ReplicatedMask, [&](auto I)
+                {
+                    archive & value.*DescriptorPointer<boost::mp11::mp_at_c<Members, I>>();
+                });
+        }
+
+    private:
+
+        template <std::size_t... I>
+        static auto MakeShadow(std::index_sequence<I...>) -> std::tuple<std::conditional_t<((ReplicatedMask >> I) & 1) != 0, FieldType<I>, std::monostate>...>;
+
+        using Shadow = decltype(MakeShadow(std::make_index_sequence<FieldCount>{}));
+
+        template <class Function>
+        static void ForEachReplicated(const std::uint64_t mask, Function&& function)
+        {
+            boost::mp11::mp_for_each<boost::mp11::mp_iota_c<FieldCount>>([&](auto I)
+                {
+                    if constexpr ((ReplicatedMask & (std::uint64_t{ 1 } << I)) != 0)
+                    {
+                        if (mask & (std::uint64_t{ 1 } << I))
+                            function(I);
+                    }
+                });
+        }
+    };
+
+    template <class Archive, UsesDescribedCodec T>
+    void serialize(Archive& archive, T& value, const unsigned int)
+    {
+        archive & boost::serialization::base_object<Component>(value);
+
+        DescribedCodec<T>::Serialize(archive, value);
+    }
+}
\ No newline at end of file
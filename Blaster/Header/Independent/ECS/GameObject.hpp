@@ -56,6 +56,7 @@ namespace Blaster::Independent::ECS
             }
 
             component->gameObject = shared_from_this();
+            component->dirtyEpoch.store(0, std::memory_order_relaxed);
             component->Initialize();
 
             componentMap.insert({ typeid(T), std::move(component) });
@@ -82,6 +83,7 @@ namespace Blaster::Independent::ECS
             }
 
             component->gameObject = shared_from_this();
+            component->dirtyEpoch.store(0, std::memory_order_relaxed);
             component->Initialize();
 
             componentMap.insert({ type, std::move(component) });
@@ -306,6 +308,8 @@ namespace Blaster::Independent::ECS
         void SetOwningClient(const std::optional<NetworkId> owningClient)
         {
             this->owningClient = owningClient;
+
+            Blaster::Independent::ECS::Synchronization::SenderSynchronization::GetInstance().UpdateOwner(GetAbsolutePath(), owningClient);
         }
 
         bool IsAuthoritative() const noexcept
@@ -333,6 +337,18 @@ namespace Blaster::Independent::ECS
             justCreated = false;
         }
 
+        [[nodiscard]]
+        std::optional<std::uint32_t> GetPrefabId() const noexcept override
+        {
+            return prefabId;
+        }
+
+        [[nodiscard]]
+        bool IsPrefabMember() const noexcept override
+        {
+            return isPrefabMember;
+        }
+
         [[nodiscard]]
         bool IsDestroyed() const noexcept override
         {
@@ -362,6 +378,12 @@ namespace Blaster::Independent::ECS
             return mutex;
         }
 
+        [[nodiscard]]
+        std::atomic<std::uint64_t>& GetDirtyEpoch() noexcept override
+        {
+            return dirtyEpoch;
+        }
+
         void SetLocallyActive(bool isLocallyActive)
         {
             this->isLocallyActive = isLocallyActive;
@@ -483,6 +505,8 @@ namespace Blaster::Independent::ECS
 
         mutable std::shared_mutex mutex;
 
+        std::atomic<std::uint64_t> dirtyEpoch = 0;
+
         bool isLocal = false;
         bool isAuthoritative = false;
 
@@ -493,6 +517,9 @@ namespace Blaster::Independent::ECS
 
         std::optional<NetworkId> owningClient = std::nullopt;
 
+        std::optional<std::uint32_t> prefabId = std::nullopt;
+        bool isPrefabMember = false;
+
         std::optional<std::weak_ptr<GameObject>> parent;
 
         std::unordered_map<std::type_index, std::shared_ptr<Component>> componentMap;
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <functional>
 #include <mutex>
 #include "Independent/ECS/GameObject.hpp"
+#include "Independent/ECS/Prefab.hpp"
 #include "Independent/Utility/SingletonManager.hpp"
 
 using namespace Blaster::Independent::Utility;
@@ -59,6 +61,106 @@ namespace Blaster::Independent::ECS
             return parentOptional.value()->AddChild(std::move(gameObject));
         }
 
+        using PrefabConfigure = std::function<void(const std::string&, const std::shared_ptr<Component>&)>;
+
+        std::shared_ptr<GameObject> Instantiate(const std::string& prefabName, const std::string& name, const std::string& path = ".", const std::optional<NetworkId>& owningClient = std::nullopt, const PrefabConfigure& configure = {})
+        {
+            const auto prefabOptional = PrefabManager::GetInstance().Get(prefabName);
+
+            if (!prefabOptional.has_value())
+                return nullptr;
+
+            return Instantiate(*prefabOptional.value(), name, path, owningClient, {}, configure);
+        }
+
+        std::shared_ptr<GameObject> Instantiate(const Prefab& prefab, const std::string& name, const std::string& path, const std::optional<NetworkId>& owningClient, const std::vector<Synchronization::PrefabOverride>& overrideList, const PrefabConfigure& configure = {}, bool markDirty = true)
+        {
+            std::shared_ptr<GameObject> root;
+
+            for (const PrefabNode& node : prefab.GetNodeList())
+            {
+                const bool isRoot = node.relativePath.empty();
+
+                std::string parentPath = path;
+                std::string nodeName = name;
+
+                if (!isRoot)
+                {
+                    const std::size_t dotPosition = node.relativePath.find_last_of('.');
+
+                    parentPath = dotPosition == std::string::npos ? root->GetAbsolutePath() : root->GetAbsolutePath() + "." + node.relativePath.substr(0, dotPosition);
+                    nodeName = dotPosition == std::string::npos ? node.relativePath : node.relativePath.substr(dotPosition + 1);
+                }
+
+                auto gameObject = GameObject::Create(nodeName, false, isRoot ? owningClient : std::nullopt);
+
+                if (isRoot)
+                    gameObject->prefabId = prefab.GetId();
+                else
+                    gameObject->isPrefabMember = true;
+
+                if (!markDirty)
+                    gameObject->ClearJustCreated();
+
+                gameObject = Register(std::move(gameObject), parentPath, markDirty);
+
+                if (!gameObject)
+                {
+                    std::cerr << "Failed to instantiate node '" << node.relativePath << "' of prefab '" << prefab.GetName() << "'!" << std::endl;
+
+                    if (isRoot)
+                        return nullptr;
+
+                    continue;
+                }
+
+                if (isRoot)
+                    root = gameObject;
+
+                for (const PrefabComponent& source : node.componentList)
+                {
+                    std::shared_ptr<Component> component = Prefab::CloneComponent(source);
+
+                    if (!component)
+                        continue;
+
+                    for (const auto& patch : overrideList)
+                    {
+                        if (patch.relativePath == node.relativePath && patch.componentType == source.componentType && !Prefab::ApplyOverride(component, patch))
+                            std::cerr << "Failed to apply override for component '" << source.componentType << "' on '" << gameObject->GetAbsolutePath() << "'!" << std::endl;
+                    }
+
+                    if (configure)
+                        configure(node.relativePath, component);
+
+                    const std::string typeName = TypeRegistrar::GetRuntimeName(source.componentType);
+
+                    if (!gameObject->HasComponentDynamic(typeName))
+                    {
+                        gameObject->AddComponentDynamic(std::move(component), markDirty);
+                        continue;
+                    }
+
+                    auto& existing = *gameObject->UnsafeFindComponentPointer(typeName);
+
+                    if (typeid(*existing) == typeid(Transform3d))
+                    {
+                        const auto transform = std::static_pointer_cast<Transform3d>(component);
+
+                        std::static_pointer_cast<Transform3d>(existing)->SetLocalPosition(transform->GetLocalPosition(), false);
+                        std::static_pointer_cast<Transform3d>(existing)->SetLocalRotation(transform->GetLocalRotation(), false);
+                        std::static_pointer_cast<Transform3d>(existing)->SetLocalScale(transform->GetLocalScale(), false);
+                    }
+                    else
+                        MergeSupport::MergeComponents(existing, component);
+
+                    ComponentPool::GetInstance().Release(source.componentType, std::move(component));
+                }
+            }
+
+            return root;
+        }
+
         void Unregister(const std::string& path) override
         {
             auto gameObjectOptional = Get(path);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <map>
@@ -40,11 +41,20 @@ namespace Blaster::Independent::ECS
         [[nodiscard]]
         virtual std::optional<NetworkId> GetOwningClient() const = 0;
 
+        [[nodiscard]]
+        virtual std::optional<std::uint32_t> GetPrefabId() const noexcept = 0;
+
+        [[nodiscard]]
+        virtual bool IsPrefabMember() const noexcept = 0;
+
         virtual void MarkDestroyed() noexcept = 0;
 
         [[nodiscard]]
         virtual std::shared_mutex& GetMutex() noexcept = 0;
 
+        [[nodiscard]]
+        virtual std::atomic<std::uint64_t>& GetDirtyEpoch() noexcept = 0;
+
         [[nodiscard]]
         virtual const std::unordered_map<std::type_index, std::shared_ptr<Component>>& GetComponentMap() const = 0;
 
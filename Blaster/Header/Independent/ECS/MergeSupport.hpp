@@ -1,10 +1,21 @@
 #pragma once
 
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/text_oarchive.hpp>
 #include <boost/describe.hpp>
 #include <boost/mp11.hpp>
+#include <boost/serialization/string.hpp>
+#include <iostream>
+#include <span>
+#include <sstream>
+#include <vector>
 #include <unordered_map>
 #include <typeindex>
 #include <memory>
+#include <optional>
+#include <tuple>
+#include <variant>
+#include "Independent/ECS/BinaryField.hpp"
 
 #define DESCRIBE_AND_REGISTER(CLASS, BASES, PUB_FNS, PROT_FNS, DATA) \
     BOOST_DESCRIBE_CLASS(CLASS, BASES, PUB_FNS, PROT_FNS, DATA)      \
@@ -79,6 +90,258 @@ namespace Blaster::Independent::ECS
         }
     }
 
+    struct FieldCodec
+    {
+        std::uint64_t(*diff)(const void*, std::shared_ptr<void>&);
+        std::vector<std::uint8_t>(*encode)(const void*, std::uint64_t);
+        bool(*apply)(void*, std::uint64_t, std::span<const std::uint8_t>);
+    };
+
+    template <class T>
+    concept UsesDescribedCodec = requires { T::UsesDescribedCodec; } && T::UsesDescribedCodec;
+
+    template <class T>
+    concept VersionsDescribedFields = requires { T::VersionsDescribedFields; } && T::VersionsDescribedFields;
+
+    template <class T>
+    struct DescribedCodec;
+
+    template <class T>
+    using DescribedMembers = boost::describe::describe_members<T, boost::describe::mod_any_access | boost::describe::mod_inherited>;
+
+    template <class Wrapper>
+    constexpr auto DescriptorPointer()
+    {
+        using M = typename UnwrapDescriptor<Wrapper>::type;
+
+        if constexpr (std::is_member_pointer_v<decltype(M::pointer)>)
+            return M::pointer;
+        else
+            return M::pointer();
+    }
+
+    template <class T, class Wrapper>
+    using DescribedFieldType = std::remove_cvref_t<decltype(std::declval<const T&>().*DescriptorPointer<Wrapper>())>;
+
+    template <class T, auto Pointer>
+    constexpr std::uint64_t DescribedFieldBit()
+    {
+        std::uint64_t result = 0;
+
+        boost::mp11::mp_for_each<boost::mp11::mp_iota_c<boost::mp11::mp_size<DescribedMembers<T>>::value>>([&](auto I)
+            {
+                constexpr auto pointer = DescriptorPointer<boost::mp11::mp_at_c<DescribedMembers<T>, I>>();
+
+                if constexpr (std::is_same_v<std::remove_cv_t<decltype(pointer)>, std::remove_cv_t<decltype(Pointer)>>)
+                {
+                    if (pointer == Pointer)
+                        result = std::uint64_t{ 1 } << I;
+                }
+            });
+
+        return result;
+    }
+
+    template <class T, class Wrapper>
+    using FieldShadowSlot = std::conditional_t<HasInequalityOperators<DescribedFieldType<T, Wrapper>>::value && std::is_copy_assignable_v<DescribedFieldType<T, Wrapper>>, DescribedFieldType<T, Wrapper>, std::monostate>;
+
+    template <class T, class Wrapper>
+    using TrackedFieldHasBinary = std::bool_constant<std::is_same_v<FieldShadowSlot<T, Wrapper>, std::monostate> || HasBinaryField<DescribedFieldType<T, Wrapper>>::value>;
+
+    template <class T>
+    struct FieldTracker
+    {
+        using Members = DescribedMembers<T>;
+        using Shadow = boost::mp11::mp_rename<boost::mp11::mp_transform_q<boost::mp11::mp_bind_front<FieldShadowSlot, T>, Members>, std::tuple>;
+
+        static constexpr std::size_t FieldCount = boost::mp11::mp_size<Members>::value;
+
+        static constexpr bool EncodesBinary = boost::mp11::mp_all_of_q<Members, boost::mp11::mp_bind_front<TrackedFieldHasBinary, T>>::value;
+
+        static_assert(FieldCount <= 64, "Field tracking supports at most 64 described fields");
+
+        template <std::size_t I>
+        using FieldType = DescribedFieldType<T, boost::mp11::mp_at_c<Members, I>>;
+
+        struct State
+        {
+            Shadow values;
+
+            const void* owner{ nullptr };
+            std::uint64_t version{ 0 };
+        };
+
+        static std::uint64_t Diff(const void* component, std::shared_ptr<void>& shadow)
+        {
+            const T& current = *static_cast<const T*>(component);
+
+            const bool fresh = shadow == nullptr;
+
+            if (fresh)
+                shadow = std::make_shared<State>();
+
+            State& state = *static_cast<State*>(shadow.get());
+
+            if constexpr (VersionsDescribedFields<T>)
+            {
+                if (!fresh && state.owner == component && state.version == current.GetFieldVersion())
+                    return 0;
+
+                state.owner = component;
+                state.version = current.GetFieldVersion();
+            }
+
+            Shadow& last = state.values;
+
+            std::uint64_t mask = 0;
+
+            boost::mp11::mp_for_each<boost::mp11::mp_iota_c<FieldCount>>([&](auto I)
+                {
+                    auto& slot = std::get<I>(last);
+
+                    if constexpr (!std::is_same_v<std::remove_cvref_t<decltype(slot)>, std::monostate>)
+                    {
+                        const auto& value = current.*DescriptorPointer<boost::mp11::mp_at_c<Members, I>>();
+
+                        if (fresh || slot != value)
+                        {
+                            slot = value;
+                            mask |= std::uint64_t{ 1 } << I;
+                        }
+                    }
+                });
+
+            return mask;
+        }
+
+        static std::vector<std::uint8_t> Encode(const void* component, const std::uint64_t mask)
+        {
+            const T& current = *static_cast<const T*>(component);
+
+            if constexpr (EncodesBinary)
+            {
+                std::vector<std::uint8_t> result;
+
+                ForEachTracked(mask, [&](auto I)
+                    {
+                        BinaryField<FieldType<I>>::Write(result, current.*DescriptorPointer<boost::mp11::mp_at_c<Members, I>>());
+                    });
+
+                return result;
+            }
+            else
+            {
+                std::ostringstream stream;
+
+                {
+                    boost::archive::text_oarchive archive(stream, boost::archive::no_header);
+
+                    ForEachTracked(mask, [&](auto I)
+                        {
+                            archive << current.*DescriptorPointer<boost::mp11::mp_at_c<Members, I>>();
+                        });
+                }
+
+                const std::string text = stream.str();
+
+                return { text.begin(), text.end() };
+            }
+        }
+
+        static bool Apply(void* component, const std::uint64_t mask, const std::span<const std::uint8_t> blob)
+        {
+            T& destination = *static_cast<T*>(component);
+
+            if (!Read(destination, mask, blob))
+                return false;
+
+            if constexpr (VersionsDescribedFields<T>)
+                destination.BumpFieldVersion();
+
+            destination.OnAfterMerge();
+
+            return true;
+        }
+
+    private:
+
+        static bool Read(T& destination, const std::uint64_t mask, const std::span<const std::uint8_t> blob)
+        {
+            if constexpr (EncodesBinary)
+            {
+                std::size_t offset = 0;
+
+                bool valid = true;
+
+                ForEachTracked(mask, [&](auto I)
+                    {
+                        if (!valid)
+                            return;
+
+                        FieldType<I> value{};
+
+                        valid = BinaryField<FieldType<I>>::Read(blob, offset, value);
+
+                        auto& field = destination.*DescriptorPointer<boost::mp11::mp_at_c<Members, I>>();
+
+                        if (valid && field != value)
+                            field = std::move(value);
+                    });
+
+                if (!valid || offset != blob.size())
+                {
+                    std::cerr << "Failed to apply field mask '" << mask << "': the field blob does not match the mask." << std::endl;
+                    return false;
+                }
+
+                return true;
+            }
+            else
+            {
+                try
+                {
+                    std::istringstream stream(std::string(blob.begin(), blob.end()));
+
+                    boost::archive::text_iarchive archive(stream, boost::archive::no_header);
+
+                    ForEachTracked(mask, [&](auto I)
+                        {
+                            FieldType<I> value{};
+
+                            archive >> value;
+
+                            auto& field = destination.*DescriptorPointer<boost::mp11::mp_at_c<Members, I>>();
+
+                            if (field != value)
+                                field = std::move(value);
+                        });
+                }
+                catch (const std::exception& exception)
+                {
+                    std::cerr << "Failed to apply field mask '" << mask << "': " << exception.what() << std::endl;
+                    return false;
+                }
+
+                return true;
+            }
+        }
+
+        template <class Function>
+        static void ForEachTracked(const std::uint64_t mask, Function&& function)
+        {
+            boost::mp11::mp_for_each<boost::mp11::mp_iota_c<FieldCount>>([&](auto I)
+                {
+                    using Slot = std::tuple_element_t<I, Shadow>;
+
+                    if constexpr (!std::is_same_v<Slot, std::monostate>)
+                    {
+                        if (mask & (std::uint64_t{ 1 } << I))
+                            function(I);
+                    }
+                });
+        }
+    };
+
     class MergeSupport final
     {
 
@@ -119,6 +382,55 @@ namespace Blaster::Independent::ECS
             iterator->second(destination.get(), incoming.get());
         }
 
+        static std::unordered_map<std::type_index, FieldCodec>& FieldTable()
+        {
+            static std::unordered_map<std::type_index, FieldCodec> table;
+
+            return table;
+        }
+
+        template <class Base>
+        static std::optional<std::uint64_t> DiffFields(const std::shared_ptr<Base>& component, std::shared_ptr<void>& shadow)
+        {
+            if (!component)
+                return std::nullopt;
+
+            const auto iterator = FieldTable().find(typeid(*component));
+
+            if (iterator == FieldTable().end())
+                return std::nullopt;
+
+            return iterator->second.diff(component.get(), shadow);
+        }
+
+        template <class Base>
+        static std::optional<std::vector<std::uint8_t>> EncodeFields(const std::shared_ptr<Base>& component, const std::uint64_t mask)
+        {
+            if (!component)
+                return std::nullopt;
+
+            const auto iterator = FieldTable().find(typeid(*component));
+
+            if (iterator == FieldTable().end())
+                return std::nullopt;
+
+            return iterator->second.encode(component.get(), mask);
+        }
+
+        template <class Base>
+        static bool ApplyFields(const std::shared_ptr<Base>& component, const std::uint64_t mask, const std::span<const std::uint8_t> blob)
+        {
+            if (!component)
+                return false;
+
+            const auto iterator = FieldTable().find(typeid(*component));
+
+            if (iterator == FieldTable().end())
+                return false;
+
+            return iterator->second.apply(component.get(), mask, blob);
+        }
+
     private:
 
         MergeSupport() = default;
@@ -135,12 +447,50 @@ namespace Blaster::Independent::ECS
 
             MergeSupport::MergeFields(derivedDestination, derivedSource);
 
+            if constexpr (VersionsDescribedFields<Derived>)
+                derivedDestination.BumpFieldVersion();
+
             derivedDestination.OnAfterMerge();
         }
 
         Registrar()
         {
             MergeSupport::Table().emplace(typeid(Derived), &Thunk);
+
+            if constexpr (UsesDescribedCodec<Derived>)
+                MergeSupport::FieldTable().emplace(typeid(Derived), FieldCodec{ &DescribedCodec<Derived>::Diff, &DescribedCodec<Derived>::EncodeFields, &DescribedCodec<Derived>::ApplyFields });
+            else if constexpr (requires { Derived::TracksDescribedFields; })
+            {
+                if (!Derived::TracksDescribedFields)
+                    return;
+
+                if constexpr (requires { &Derived::EncodeTrackedFields; &Derived::ApplyTrackedFields; })
+                    MergeSupport::FieldTable().emplace(typeid(Derived), FieldCodec{ &FieldTracker<Derived>::Diff, &EncodeCustom, &ApplyCustom });
+                else
+                    MergeSupport::FieldTable().emplace(typeid(Derived), FieldCodec{ &FieldTracker<Derived>::Diff, &FieldTracker<Derived>::Encode, &FieldTracker<Derived>::Apply });
+            }
+        }
+
+    private:
+
+        static std::vector<std::uint8_t> EncodeCustom(const void* component, const std::uint64_t mask)
+        {
+            return Derived::EncodeTrackedFields(*static_cast<const Derived*>(component), mask);
+        }
+
+        static bool ApplyCustom(void* component, const std::uint64_t mask, const std::span<const std::uint8_t> blob)
+        {
+            Derived& destination = *static_cast<Derived*>(component);
+
+            if (!Derived::ApplyTrackedFields(destination, mask, blob))
+                return false;
+
+            if constexpr (VersionsDescribedFields<Derived>)
+                destination.BumpFieldVersion();
+
+            destination.OnAfterMerge();
+
+            return true;
         }
     };
 }
\ No newline at end of file
@@ -0,0 +1,292 @@
+#pragma once
+
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "Independent/ECS/Synchronization/CommonSynchronization.hpp"
+#include "Independent/ECS/Synchronization/ComponentStateCodec.hpp"
+#include "Independent/ECS/ComponentPool.hpp"
+#include "Independent/ECS/MergeSupport.hpp"
+#include "Independent/Utility/SingletonManager.hpp"
+#include "Independent/Utility/TypeRegistrar.hpp"
+
+namespace Blaster::Independent::ECS
+{
+    struct PrefabComponent
+    {
+        int componentType;
+
+        std::shared_ptr<Component> instance;
+
+        std::vector<std::uint8_t> state;
+    };
+
+    struct PrefabNode
+    {
+        std::string relativePath;
+
+        std::vector<PrefabComponent> componentList;
+    };
+
+    class Prefab final
+    {
+
+    public:
+
+        using NodeSource = std::pair<std::string, std::vector<std::shared_ptr<Component>>>;
+
+        Prefab(const Prefab&) = delete;
+        Prefab(Prefab&&) = delete;
+        Prefab& operator=(const Prefab&) = delete;
+        Prefab& operator=(Prefab&&) = delete;
+
+        [[nodiscard]]
+        std::uint32_t GetId() const
+        {
+            return id;
+        }
+
+        [[nodiscard]]
+        std::string GetName() const
+        {
+            return name;
+        }
+
+        [[nodiscard]]
+        const std::vector<PrefabNode>& GetNodeList() const
+        {
+            return nodeList;
+        }
+
+        [[nodiscard]]
+        const PrefabNode* FindNode(const std::string& relativePath) const
+        {
+            const auto iterator = std::ranges::find(nodeList, relativePath, &PrefabNode::relativePath);
+
+            return iterator == nodeList.end() ? nullptr : &*iterator;
+        }
+
+        static std::shared_ptr<Component> CloneComponent(const PrefabComponent& source)
+        {
+            std::shared_ptr<Component> result = ComponentPool::GetInstance().Acquire(source.componentType);
+
+            if (!result || !Synchronization::ComponentStateCodec::DecodeInto(source.componentType, source.state, *result))
+            {
+                std::cerr << "Failed to clone prefab component of type '" << source.componentType << "'." << std::endl;
+                return nullptr;
+            }
+
+            return result;
+        }
+
+        static bool ApplyOverride(const std::shared_ptr<Component>& component, const Synchronization::PrefabOverride& patch)
+        {
+            if (patch.fieldMask == 0)
+                return Synchronization::ComponentStateCodec::DecodeInto(patch.componentType, patch.blob, *component);
+
+            return MergeSupport::ApplyFields(component, patch.fieldMask, patch.blob);
+        }
+
+        static std::optional<Synchronization::PrefabOverride> MakeOverride(const std::string& relativePath, const PrefabComponent& source, const std::shared_ptr<Component>& component)
+        {
+            std::vector<std::uint8_t> state = Synchronization::ComponentStateCodec::Encode(source.componentType, *component);
+
+            if (state == source.state)
+                return std::nullopt;
+
+            std::shared_ptr<void> shadow;
+
+            if (MergeSupport::DiffFields(source.instance, shadow).has_value())
+            {
+                const std::uint64_t fieldMask = MergeSupport::DiffFields(component, shadow).value_or(0);
+
+                std::optional<std::vector<std::uint8_t>> fieldBlob = fieldMask != 0 ? MergeSupport::EncodeFields(component, fieldMask) : std::nullopt;
+
+                if (fieldBlob.has_value() && Reproduces(source, fieldMask, fieldBlob.value(), state))
+                    return Synchronization::PrefabOverride{ relativePath, source.componentType, fieldMask, std::move(fieldBlob.value()) };
+            }
+
+            return Synchronization::PrefabOverride{ relativePath, source.componentType, 0, std::move(state) };
+        }
+
+        static std::shared_ptr<Prefab> Create(const std::string& name, const std::vector<NodeSource>& sourceList)
+        {
+            std::shared_ptr<Prefab> result(new Prefab());
+
+            result->name = name;
+            result->id = HashName(name);
+
+            for (const auto& [relativePath, componentList] : sourceList)
+            {
+                PrefabNode node{ relativePath, {} };
+
+                for (const auto& component : componentList)
+                {
+                    const auto typeId = Utility::TypeRegistrar::GetIdFromRuntimeName(component->GetTypeName());
+
+                    if (!typeId.has_value())
+                    {
+                        std::cerr << "Prefab '" << name << "' has unregistered component '" << component->GetTypeName() << "'; skipping it." << std::endl;
+                        continue;
+                    }
+
+                    PrefabComponent entry{ static_cast<int>(typeId.value()), nullptr, Synchronization::ComponentStateCodec::Encode(typeId.value(), *component) };
+
+                    entry.instance = CloneComponent(entry);
+
+                    if (entry.instance)
+                        node.componentList.push_back(std::move(entry));
+                }
+
+                result->nodeList.push_back(std::move(node));
+            }
+
+            if (result->FindNode("") == nullptr)
+                result->nodeList.push_back({ "", {} });
+
+            std::ranges::stable_sort(result->nodeList, {}, [](const PrefabNode& node) { return node.relativePath.empty() ? 0 : std::ranges::count(node.relativePath, '.') + 1; });
+
+            return result;
+        }
+
+    private:
+
+        Prefab() = default;
+
+        static bool Reproduces(const PrefabComponent& source, const std::uint64_t fieldMask, const std::vector<std::uint8_t>& fieldBlob, const std::vector<std::uint8_t>& state)
+        {
+            const std::shared_ptr<Component> scratch = CloneComponent(source);
+
+            if (!scratch || !MergeSupport::ApplyFields(scratch, fieldMask, fieldBlob))
+                return false;
+
+            return Synchronization::ComponentStateCodec::Encode(source.componentType, *scratch) == state;
+        }
+
+        static std::uint32_t HashName(const std::string& name)
+        {
+            std::uint32_t hash = 2166136261u;
+
+            for (const char character : name)
+                hash = (hash ^ static_cast<std::uint8_t>(character)) * 16777619u;
+
+            return hash;
+        }
+
+        std::string name;
+        std::uint32_t id{ 0 };
+
+        std::vector<PrefabNode> nodeList;
+
+    };
+
+    class PrefabManager final : public Utility::SingletonManager<std::shared_ptr<Prefab>, const std::string&>
+    {
+
+    public:
+
+        PrefabManager(const PrefabManager&) = delete;
+        PrefabManager(PrefabManager&&) = delete;
+        PrefabManager& operator=(const PrefabManager&) = delete;
+        PrefabManager& operator=(PrefabManager&&) = delete;
+
+        std::shared_ptr<Prefab> Register(std::shared_ptr<Prefab> object) override
+        {
+            const std::string name = object->GetName();
+
+            if (prefabMap.contains(name))
+            {
+                std::cerr << "Prefab map already has prefab '" << name << "'!" << std::endl;
+                return nullptr;
+            }
+
+            if (const auto iterator = idMap.find(object->GetId()); iterator != idMap.end())
+            {
+                std::cerr << "Prefab '" << name << "' has the same id as prefab '" << iterator->second->GetName() << "'; rename one of them!" << std::endl;
+                return nullptr;
+            }
+
+            idMap.insert({ object->GetId(), object });
+            prefabMap.insert({ name, std::move(object) });
+
+            return prefabMap[name];
+        }
+
+        void Unregister(const std::string& name) override
+        {
+            if (!prefabMap.contains(name))
+            {
+                std::cerr << "Prefab map doesn't have prefab '" << name << "'!" << std::endl;
+                return;
+            }
+
+            idMap.erase(prefabMap[name]->GetId());
+            prefabMap.erase(name);
+        }
+
+        bool Has(const std::string& name) const override
+        {
+            return prefabMap.contains(name);
+        }
+
+        std::optional<std::shared_ptr<Prefab>> Get(const std::string& name) override
+        {
+            if (!prefabMap.contains(name))
+            {
+                std::cerr << "Prefab map doesn't have prefab '" << name << "'!" << std::endl;
+                return std::nullopt;
+            }
+
+            return std::make_optional(prefabMap[name]);
+        }
+
+        std::optional<std::shared_ptr<Prefab>> Get(const std::uint32_t id)
+        {
+            if (!idMap.contains(id))
+            {
+                std::cerr << "Prefab map doesn't have prefab with id '" << id << "'!" << std::endl;
+                return std::nullopt;
+            }
+
+            return std::make_optional(idMap[id]);
+        }
+
+        std::vector<std::shared_ptr<Prefab>> GetAll() const override
+        {
+            std::vector<std::shared_ptr<Prefab>> result(prefabMap.size());
+
+            std::ranges::transform(prefabMap, result.begin(), [](const auto& pair) { return pair.second; });
+
+            return result;
+        }
+
+        static PrefabManager& GetInstance()
+        {
+            std::call_once(initializationFlag, [&]()
+            {
+                instance = std::unique_ptr<PrefabManager>(new PrefabManager());
+            });
+
+            return *instance;
+        }
+
+    private:
+
+        PrefabManager() = default;
+
+        std::unordered_map<std::string, std::shared_ptr<Prefab>> prefabMap;
+        std::unordered_map<std::uint32_t, std::shared_ptr<Prefab>> idMap;
+
+        static std::once_flag initializationFlag;
+        static std::unique_ptr<PrefabManager> instance;
+
+    };
+
+    std::once_flag PrefabManager::initializationFlag;
+    std::unique_ptr<PrefabManager> PrefabManager::instance;
+}
\ No newline at end of file
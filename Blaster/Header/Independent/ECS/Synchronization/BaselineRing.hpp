@@ -0,0 +1,206 @@
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "Independent/Network/CommonNetwork.hpp"
+
+using namespace Blaster::Independent::Network;
+
+namespace Blaster::Independent::ECS::Synchronization
+{
+    class BaselineRing final
+    {
+
+    public:
+
+        struct Baseline
+        {
+            std::uint64_t sequence{ 0 };
+
+            std::shared_ptr<const std::vector<std::uint8_t>> blob;
+        };
+
+        BaselineRing() = default;
+
+        BaselineRing(const BaselineRing&) = delete;
+        BaselineRing(BaselineRing&&) = delete;
+        BaselineRing& operator=(const BaselineRing&) = delete;
+        BaselineRing& operator=(BaselineRing&&) = delete;
+
+        void Record(const std::string& key, const std::uint64_t sequence, std::shared_ptr<const std::vector<std::uint8_t>> blob)
+        {
+            std::unique_lock guard(mutex);
+
+            auto& entryList = entryMap[key];
+
+            if (!entryList.empty() && entryList.back().sequence == sequence)
+            {
+                entryList.back().blob = std::move(blob);
+                return;
+            }
+
+            if (!entryList.empty() && entryList.back().sequence > sequence)
+                entryList.clear();
+
+            entryList.push_back({ sequence, std::move(blob) });
+
+            while (entryList.size() > kDepth)
+                entryList.pop_front();
+        }
+
+        [[nodiscard]]
+        std::optional<Baseline> FindNewestAcked(const std::string& key, const std::uint64_t ackedSequence) const
+        {
+            std::unique_lock guard(mutex);
+
+            const auto hit = entryMap.find(key);
+
+            if (hit == entryMap.end())
+                return std::nullopt;
+
+            for (auto iterator = hit->second.rbegin(); iterator != hit->second.rend(); ++iterator)
+            {
+                if (iterator->sequence <= ackedSequence)
+                    return *iterator;
+            }
+
+            return std::nullopt;
+        }
+
+        [[nodiscard]]
+        std::shared_ptr<const std::vector<std::uint8_t>> Find(const std::string& key, const std::uint64_t sequence) const
+        {
+            std::unique_lock guard(mutex);
+
+            const auto hit = entryMap.find(key);
+
+            if (hit == entryMap.end())
+                return nullptr;
+
+            for (const auto& entry : hit->second)
+            {
+                if (entry.sequence == sequence)
+                    return entry.blob;
+            }
+
+            return nullptr;
+        }
+
+        void Forget(const std::string& key)
+        {
+            std::unique_lock guard(mutex);
+
+            entryMap.erase(key);
+        }
+
+        void ForgetPath(const std::string& path)
+        {
+            std::unique_lock guard(mutex);
+
+            std::erase_if(entryMap, [&path](const auto& entry) { return entry.first.starts_with(path + "#") || entry.first.starts_with(path + "."); });
+        }
+
+        void Clear()
+        {
+            std::unique_lock guard(mutex);
+
+            entryMap.clear();
+        }
+
+        static std::string MakeKey(const std::string& path, const int componentType)
+        {
+            return path + "#" + std::to_string(componentType);
+        }
+
+        static std::vector<std::uint8_t> EncodeDelta(const std::span<const std::uint8_t> baseline, const std::span<const std::uint8_t> target)
+        {
+            std::vector<std::uint8_t> result;
+
+            CommonNetwork::WriteTrivial(result, static_cast<std::uint32_t>(target.size()));
+
+            std::size_t index = 0;
+
+            while (index < target.size())
+            {
+                const std::size_t skipStart = index;
+
+                while (index < target.size() && index - skipStart < kMaximumRun && ByteAt(baseline, index) == target[index])
+                    ++index;
+
+                const std::size_t literalStart = index;
+
+                while (index < target.size() && index - literalStart < kMaximumRun && ByteAt(baseline, index) != target[index])
+                    ++index;
+
+                if (index == literalStart && index == target.size())
+                    break;
+
+                CommonNetwork::WriteTrivial(result, static_cast<std::uint16_t>(literalStart - skipStart));
+                CommonNetwork::WriteTrivial(result, static_cast<std::uint16_t>(index - literalStart));
+
+                for (std::size_t i = literalStart; i < index; ++i)
+                    result.push_back(static_cast<std::uint8_t>(target[i] ^ ByteAt(baseline, i)));
+            }
+
+            return result;
+        }
+
+        static std::optional<std::vector<std::uint8_t>> DecodeDelta(const std::span<const std::uint8_t> baseline, const std::span<const std::uint8_t> delta)
+        {
+            if (delta.size() < sizeof(std::uint32_t))
+                return std::nullopt;
+
+            std::size_t offset = 0;
+
+            const std::uint32_t targetSize = CommonNetwork::ReadTrivial<std::uint32_t>(delta, offset);
+
+            std::vector<std::uint8_t> result(baseline.begin(), baseline.end());
+
+            result.resize(targetSize, 0);
+
+            std::size_t position = 0;
+
+            while (offset < delta.size())
+            {
+                if (offset + 2 * sizeof(std::uint16_t) > delta.size())
+                    return std::nullopt;
+
+                position += CommonNetwork::ReadTrivial<std::uint16_t>(delta, offset);
+
+                const std::uint16_t count = CommonNetwork::ReadTrivial<std::uint16_t>(delta, offset);
+
+                if (position + count > result.size() || offset + count > delta.size())
+                    return std::nullopt;
+
+                for (std::uint16_t i = 0; i < count; ++i)
+                    result[position + i] ^= delta[offset + i];
+
+                position += count;
+                offset += count;
+            }
+
+            return result;
+        }
+
+    private:
+
+        static std::uint8_t ByteAt(const std::span<const std::uint8_t> bytes, const std::size_t index)
+        {
+            return index < bytes.size() ? bytes[index] : 0;
+        }
+
+        std::unordered_map<std::string, std::deque<Baseline>> entryMap;
+
+        mutable std::mutex mutex;
+
+        static constexpr std::size_t kDepth = 8;
+        static constexpr std::size_t kMaximumRun = 0xFFFF;
+
+    };
+}
\ No newline at end of file
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <typeindex>
+#include "Independent/ECS/Synchronization/NetworkEntityTable.hpp"
 #include "Independent/Network/CommonNetwork.hpp"
 
 using namespace Blaster::Independent::Network;
@@ -34,7 +36,9 @@ namespace Blaster::Independent::ECS::Synchronization
 		Destroy = 2,
 		AddComponent = 3,
 		RemoveComponent = 4,
-		SetField = 5
+		SetField = 5,
+		DeltaField = 6,
+		Spawn = 7
 	};
 
     struct OpCreate
@@ -45,6 +49,8 @@ namespace Blaster::Independent::ECS::Synchronization
         std::string className;
 
         std::optional<NetworkId> owner;
+
+        EntityId entityId{ 0 };
     };
 
     struct OpDestroy
@@ -52,6 +58,8 @@ namespace Blaster::Independent::ECS::Synchronization
         static constexpr OpCode Code = OpCode::Destroy;
 
         std::string path;
+
+        EntityId entityId{ 0 };
     };
 
     struct OpAddComponent
@@ -61,6 +69,8 @@ namespace Blaster::Independent::ECS::Synchronization
         std::string path;
         int componentType;
         std::vector<std::uint8_t> blob;
+
+        EntityId entityId{ 0 };
     };
 
     struct OpRemoveComponent
@@ -69,6 +79,8 @@ namespace Blaster::Independent::ECS::Synchronization
 
         std::string path;
         int componentType;
+
+        EntityId entityId{ 0 };
     };
 
     struct OpSetField
@@ -77,10 +89,57 @@ namespace Blaster::Independent::ECS::Synchronization
 
         std::string path;
         int componentType;
-        std::string field;
+
+        std::uint64_t fieldMask;
+        std::vector<std::uint8_t> blob;
+
+        EntityId entityId{ 0 };
+    };
+
+    struct OpDeltaField
+    {
+        static constexpr OpCode Code = OpCode::DeltaField;
+
+        std::string path;
+        int componentType;
+
+        std::uint64_t baseline;
+        std::vector<std::uint8_t> blob;
+
+        EntityId entityId{ 0 };
+    };
+
+    struct BaselineMiss
+    {
+        std::string path;
+        int componentType;
+
+        std::uint64_t baseline;
+    };
+
+    struct PrefabOverride
+    {
+        std::string relativePath;
+        int componentType;
+
+        std::uint64_t fieldMask;
         std::vector<std::uint8_t> blob;
     };
 
+    struct OpSpawn
+    {
+        static constexpr OpCode Code = OpCode::Spawn;
+
+        std::string path;
+        std::uint32_t prefabId;
+
+        std::optional<NetworkId> owner;
+
+        std::vector<PrefabOverride> overrideList;
+
+        EntityId entityId{ 0 };
+    };
+
 #if defined(_MSC_VER)
 #pragma pack(push, 1)
 #endif
@@ -91,6 +150,7 @@ namespace Blaster::Independent::ECS::Synchronization
         std::uint64_t ack;
         Route route;
         Blaster::Independent::Network::NetworkId origin; 
+        std::uint64_t tick;
     }
 #if defined(_MSC_VER)
     ;
@@ -120,6 +180,7 @@ struct Blaster::Independent::Network::DataConversion<Blaster::Independent::ECS::
         CommonNetwork::WriteTrivial(buffer, value.ack);
         CommonNetwork::WriteTrivial(buffer, value.route);
         CommonNetwork::WriteTrivial(buffer, value.origin);
+        CommonNetwork::WriteTrivial(buffer, value.tick);
     }
 
     static std::any Decode(std::span<const std::uint8_t> bytes)
@@ -133,6 +194,7 @@ struct Blaster::Independent::Network::DataConversion<Blaster::Independent::ECS::
         header.ack = CommonNetwork::ReadTrivial<std::uint64_t>(bytes, offset);
         header.route = (Blaster::Independent::ECS::Synchronization::Route) CommonNetwork::ReadTrivial<std::uint8_t>(bytes, offset);
         header.origin = CommonNetwork::ReadTrivial<std::uint32_t>(bytes, offset);
+        header.tick = CommonNetwork::ReadTrivial<std::uint64_t>(bytes, offset);
 
         return header;
     }
@@ -173,6 +235,7 @@ struct Blaster::Independent::Network::DataConversion<Blaster::Independent::ECS::
 
     static void Encode(const Type& operation, std::vector<std::uint8_t>& buffer)
     {
+        CommonNetwork::WriteTrivial(buffer, operation.entityId);
         CommonNetwork::EncodeString(buffer, operation.path);
         CommonNetwork::EncodeString(buffer, operation.className);
 
@@ -190,6 +253,7 @@ struct Blaster::Independent::Network::DataConversion<Blaster::Independent::ECS::
 
         Type out;
 
+        out.entityId = CommonNetwork::ReadTrivial<Blaster::Independent::ECS::Synchronization::EntityId>(bytes, offset);
         out.path = CommonNetwork::DecodeString(bytes, offset);
         out.className = CommonNetwork::DecodeString(bytes, offset);
 
@@ -209,14 +273,16 @@ struct Blaster::Independent::Network::DataConversion<Blaster::Independent::ECS::
 
     static void Encode(const Type& operation, std::vector<std::uint8_t>& buffer)
     {
-        CommonNetwork::EncodeString(buffer, operation.path);
+        Blaster::Independent::ECS::Synchronization::NetworkEntityTable::WriteReference(buffer, operation.entityId, operation.path);
     }
 
     static std::any Decode(std::span<const std::uint8_t> bytes)
     {
         std::size_t offset = 0;
 
-        return Type{ CommonNetwork::DecodeString(bytes, offset) };
+        const auto reference = Blaster::Independent::ECS::Synchronization::NetworkEntityTable::ReadReference(bytes, offset);
+
+        return Type{ reference.path, reference.id };
     }
 };
 
@@ -227,7 +293,7 @@ struct Blaster::Independent::Network::DataConversion<Blaster::Independent::ECS::
 
     static void Encode(const Type& operation, std::vector<std::uint8_t>& buffer)
     {
-        CommonNetwork::EncodeString(buffer, operation.path);
+        Blaster::Independent::ECS::Synchronization::NetworkEntityTable::WriteReference(buffer, operation.entityId, operation.path);
         CommonNetwork::WriteTrivial(buffer, operation.componentType);
 
         const std::uint32_t length = static_cast<std::uint32_t>(operation.blob.size());
@@ -242,7 +308,10 @@ struct Blaster::Independent::Network::DataConversion<Blaster::Independent::ECS::
 
         Type result;
 
-        result.path = CommonNetwork::DecodeString(bytes, offset);
+        const auto reference = Blaster::Independent::ECS::Synchronization::NetworkEntityTable::ReadReference(bytes, offset);
+
+        result.path = reference.path;
+        result.entityId = reference.id;
         result.componentType = CommonNetwork::ReadTrivial<int>(bytes, offset);
 
         const std::uint32_t length = CommonNetwork::ReadTrivial<std::uint32_t>(bytes, offset);
@@ -261,7 +330,7 @@ struct Blaster::Independent::Network::DataConversion<Blaster::Independent::ECS::
 
     static void Encode(const Type& operation, std::vector<std::uint8_t>& buffer)
     {
-        CommonNetwork::EncodeString(buffer, operation.path);
+        Blaster::Independent::ECS::Synchronization::NetworkEntityTable::WriteReference(buffer, operation.entityId, operation.path);
         CommonNetwork::WriteTrivial(buffer, operation.componentType);
     }
 
@@ -271,7 +340,10 @@ struct Blaster::Independent::Network::DataConversion<Blaster::Independent::ECS::
 
         Type result;
 
-        result.path = CommonNetwork::DecodeString(bytes, offset);
+        const auto reference = Blaster::Independent::ECS::Synchronization::NetworkEntityTable::ReadReference(bytes, offset);
+
+        result.path = reference.path;
+        result.entityId = reference.id;
         result.componentType = CommonNetwork::ReadTrivial<int>(bytes, offset);
 
         return result;
@@ -285,9 +357,9 @@ struct Blaster::Independent::Network::DataConversion<Blaster::Independent::ECS::
 
     static void Encode(const Type& operation, std::vector<std::uint8_t>& buffer)
     {
-        CommonNetwork::EncodeString(buffer, operation.path);
+        Blaster::Independent::ECS::Synchronization::NetworkEntityTable::WriteReference(buffer, operation.entityId, operation.path);
         CommonNetwork::WriteTrivial(buffer, operation.componentType);
-        CommonNetwork::EncodeString(buffer, operation.field);
+        CommonNetwork::WriteTrivial(buffer, operation.fieldMask);
         CommonNetwork::EncodeBlob(buffer, operation.blob);
     }
 
@@ -297,11 +369,131 @@ struct Blaster::Independent::Network::DataConversion<Blaster::Independent::ECS::
 
         Type result;
 
-        result.path = CommonNetwork::DecodeString(bytes, offset);
+        const auto reference = Blaster::Independent::ECS::Synchronization::NetworkEntityTable::ReadReference(bytes, offset);
+
+        result.path = reference.path;
+        result.entityId = reference.id;
+        result.componentType = CommonNetwork::ReadTrivial<int>(bytes, offset);
+        result.fieldMask = CommonNetwork::ReadTrivial<std::uint64_t>(bytes, offset);
+        result.blob = CommonNetwork::DecodeBlob(bytes, offset);
+
+        return result;
+    }
+};
+
+template <>
+struct Blaster::Independent::Network::DataConversion<Blaster::Independent::ECS::Synchronization::OpDeltaField> : Blaster::Independent::Network::DataConversionBase<Blaster::Independent::Network::DataConversion<Blaster::Independent::ECS::Synchronization::OpDeltaField>, Blaster::Independent::ECS::Synchronization::OpDeltaField>
+{
+    using Type = Blaster::Independent::ECS::Synchronization::OpDeltaField;
+
+    static void Encode(const Type& operation, std::vector<std::uint8_t>& buffer)
+    {
+        Blaster::Independent::ECS::Synchronization::NetworkEntityTable::WriteReference(buffer, operation.entityId, operation.path);
+        CommonNetwork::WriteTrivial(buffer, operation.componentType);
+        CommonNetwork::WriteTrivial(buffer, operation.baseline);
+        CommonNetwork::EncodeBlob(buffer, operation.blob);
+    }
+
+    static std::any Decode(std::span<const std::uint8_t> bytes)
+    {
+        std::size_t offset = 0;
+
+        Type result;
+
+        const auto reference = Blaster::Independent::ECS::Synchronization::NetworkEntityTable::ReadReference(bytes, offset);
+
+        result.path = reference.path;
+        result.entityId = reference.id;
         result.componentType = CommonNetwork::ReadTrivial<int>(bytes, offset);
-        result.field = CommonNetwork::DecodeString(bytes, offset);
+        result.baseline = CommonNetwork::ReadTrivial<std::uint64_t>(bytes, offset);
         result.blob = CommonNetwork::DecodeBlob(bytes, offset);
 
+        return result;
+    }
+};
+
+template <>
+struct Blaster::Independent::Network::DataConversion<Blaster::Independent::ECS::Synchronization::BaselineMiss> : Blaster::Independent::Network::DataConversionBase<Blaster::Independent::Network::DataConversion<Blaster::Independent::ECS::Synchronization::BaselineMiss>, Blaster::Independent::ECS::Synchronization::BaselineMiss>
+{
+    using Type = Blaster::Independent::ECS::Synchronization::BaselineMiss;
+
+    static void Encode(const Type& value, std::vector<std::uint8_t>& buffer)
+    {
+        CommonNetwork::EncodeString(buffer, value.path);
+        CommonNetwork::WriteTrivial(buffer, value.componentType);
+        CommonNetwork::WriteTrivial(buffer, value.baseline);
+    }
+
+    static std::any Decode(std::span<const std::uint8_t> bytes)
+    {
+        std::size_t offset = 0;
+
+        Type result;
+
+        result.path = CommonNetwork::DecodeString(bytes, offset);
+        result.componentType = CommonNetwork::ReadTrivial<int>(bytes, offset);
+        result.baseline = CommonNetwork::ReadTrivial<std::uint64_t>(bytes, offset);
+
+        return result;
+    }
+};
+
+template <>
+struct Blaster::Independent::Network::DataConversion<Blaster::Independent::ECS::Synchronization::OpSpawn> : Blaster::Independent::Network::DataConversionBase<Blaster::Independent::Network::DataConversion<Blaster::Independent::ECS::Synchronization::OpSpawn>, Blaster::Independent::ECS::Synchronization::OpSpawn>
+{
+    using Type = Blaster::Independent::ECS::Synchronization::OpSpawn;
+
+    static void Encode(const Type& operation, std::vector<std::uint8_t>& buffer)
+    {
+        CommonNetwork::WriteTrivial(buffer, operation.entityId);
+        CommonNetwork::EncodeString(buffer, operation.path);
+        CommonNetwork::WriteTrivial(buffer, operation.prefabId);
+
+        const bool hasOwner = operation.owner.has_value();
+
+        CommonNetwork::WriteTrivial(buffer, static_cast<std::uint8_t>(hasOwner));
+
+        if (hasOwner)
+            CommonNetwork::WriteTrivial(buffer, operation.owner.value());
+
+        CommonNetwork::WriteTrivial(buffer, static_cast<std::uint16_t>(operation.overrideList.size()));
+
+        for (const auto& patch : operation.overrideList)
+        {
+            CommonNetwork::EncodeString(buffer, patch.relativePath);
+            CommonNetwork::WriteTrivial(buffer, patch.componentType);
+            CommonNetwork::WriteTrivial(buffer, patch.fieldMask);
+            CommonNetwork::EncodeBlob(buffer, patch.blob);
+        }
+    }
+
+    static std::any Decode(std::span<const std::uint8_t> bytes)
+    {
+        std::size_t offset = 0;
+
+        Type result;
+
+        result.entityId = CommonNetwork::ReadTrivial<Blaster::Independent::ECS::Synchronization::EntityId>(bytes, offset);
+        result.path = CommonNetwork::DecodeString(bytes, offset);
+        result.prefabId = CommonNetwork::ReadTrivial<std::uint32_t>(bytes, offset);
+
+        const bool hasOwner = CommonNetwork::ReadTrivial<std::uint8_t>(bytes, offset);
+
+        if (hasOwner)
+            result.owner = CommonNetwork::ReadTrivial<NetworkId>(bytes, offset);
+
+        const auto count = CommonNetwork::ReadTrivial<std::uint16_t>(bytes, offset);
+
+        result.overrideList.resize(count);
+
+        for (auto& patch : result.overrideList)
+        {
+            patch.relativePath = CommonNetwork::DecodeString(bytes, offset);
+            patch.componentType = CommonNetwork::ReadTrivial<int>(bytes, offset);
+            patch.fieldMask = CommonNetwork::ReadTrivial<std::uint64_t>(bytes, offset);
+            patch.blob = CommonNetwork::DecodeBlob(bytes, offset);
+        }
+
         return result;
     }
 };
\ No newline at end of file
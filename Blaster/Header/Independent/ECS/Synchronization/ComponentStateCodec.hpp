@@ -0,0 +1,76 @@
+#pragma once
+
+#include <iostream>
+#include <span>
+#include <spanstream>
+#include <sstream>
+#include <vector>
+#include <boost/archive/archive_exception.hpp>
+#include "Independent/ECS/ComponentFactory.hpp"
+
+namespace Blaster::Independent::ECS::Synchronization
+{
+    class ComponentStateCodec final
+    {
+
+    public:
+
+        ComponentStateCodec(const ComponentStateCodec&) = delete;
+        ComponentStateCodec(ComponentStateCodec&&) = delete;
+        ComponentStateCodec& operator=(const ComponentStateCodec&) = delete;
+        ComponentStateCodec& operator=(ComponentStateCodec&&) = delete;
+
+        static std::vector<std::uint8_t> Encode(const std::uint64_t componentType, const Component& component)
+        {
+            if (auto binary = ComponentFactory::SaveBinary(componentType, component); binary.has_value())
+                return std::move(binary.value());
+
+            std::ostringstream stream;
+
+            {
+                boost::archive::text_oarchive archive(stream, boost::archive::no_header);
+
+                if (!ComponentFactory::Save(componentType, archive, component))
+                    return {};
+            }
+
+            const std::string& text = stream.str();
+
+            return { text.begin(), text.end() };
+        }
+
+        static bool DecodeInto(const std::uint64_t componentType, const std::span<const std::uint8_t> blob, Component& component)
+        {
+            if (const auto binary = ComponentFactory::LoadBinary(componentType, blob, component); binary.has_value())
+            {
+                if (!binary.value())
+                    std::cerr << "Corrupt binary component state for type '" << componentType << "'." << std::endl;
+
+                return binary.value();
+            }
+
+            static thread_local std::ispanstream stream(std::span<const char>{});
+
+            stream.clear();
+            stream.span(std::span<const char>(reinterpret_cast<const char*>(blob.data()), blob.size()));
+
+            try
+            {
+                boost::archive::text_iarchive archive(stream, boost::archive::no_header);
+
+                return ComponentFactory::Load(componentType, archive, component);
+            }
+            catch (const boost::archive::archive_exception& exception)
+            {
+                std::cerr << "Corrupt component state: " << exception.what() << std::endl;
+
+                return false;
+            }
+        }
+
+    private:
+
+        ComponentStateCodec() = default;
+
+    };
+}
\ No newline at end of file
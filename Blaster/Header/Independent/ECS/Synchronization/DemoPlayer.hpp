@@ -0,0 +1,309 @@
+#pragma once
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+#include "Independent/ECS/Synchronization/DemoRecorder.hpp"
+#include "Independent/ECS/Synchronization/ReceiverSynchronization.hpp"
+#include "Independent/ECS/GameObjectManager.hpp"
+
+namespace Blaster::Independent::ECS::Synchronization
+{
+    class DemoPlayer final
+    {
+
+    public:
+
+        DemoPlayer(const DemoPlayer&) = delete;
+        DemoPlayer(DemoPlayer&&) = delete;
+        DemoPlayer& operator=(const DemoPlayer&) = delete;
+        DemoPlayer& operator=(DemoPlayer&&) = delete;
+
+        bool Open(const std::string& path)
+        {
+            file = std::ifstream(path, std::ios::binary | std::ios::ate);
+
+            if (!file.is_open())
+            {
+                std::cerr << "Failed to open demo file '" << path << "'." << std::endl;
+                return false;
+            }
+
+            const auto fileSize = static_cast<std::uint64_t>(file.tellg());
+
+            file.seekg(0);
+
+            if (fileSize < DemoFormat::kHeaderSize || ReadValue<std::uint32_t>() != DemoFormat::kMagic || ReadValue<std::uint32_t>() != DemoFormat::kVersion)
+            {
+                std::cerr << "'" << path << "' is not a demo file." << std::endl;
+
+                file.close();
+
+                return false;
+            }
+
+            if (!ReadIndex(fileSize))
+                RebuildIndex(fileSize);
+
+            std::cout << "Opened demo '" << path << "' with '" << indexList.size() << "' keyframe(s)." << std::endl;
+
+            Seek(0.0);
+
+            return true;
+        }
+
+        void Update(const float deltaTime)
+        {
+            if (!file.is_open() || paused)
+                return;
+
+            playTime += static_cast<double>(deltaTime) * 1000.0 * speed;
+
+            AdvanceTo(playTime);
+        }
+
+        void Seek(const double seconds)
+        {
+            if (!file.is_open())
+                return;
+
+            const double target = std::max(0.0, seconds * 1000.0);
+
+            const auto keyframe = std::ranges::upper_bound(indexList, static_cast<std::uint64_t>(target), {}, &DemoIndexEntry::time);
+
+            ResetWorld();
+
+            pendingRecord.reset();
+
+            if (keyframe == indexList.begin())
+                readOffset = DemoFormat::kHeaderSize;
+            else
+            {
+                readOffset = std::prev(keyframe)->offset;
+
+                if (std::optional<Record> record = ReadRecord(); record.has_value() && record->kind == DemoRecordKind::Keyframe)
+                    ReceiverSynchronization::GetInstance().PlaySnapshot(std::move(record->snapshot));
+            }
+
+            playTime = target;
+
+            AdvanceTo(playTime);
+
+            std::cout << "Seeked demo to '" << seconds << "' s." << std::endl;
+        }
+
+        void SetSpeed(const double speed)
+        {
+            this->speed = std::clamp(speed, kMinimumSpeed, kMaximumSpeed);
+        }
+
+        void SetPaused(const bool paused)
+        {
+            this->paused = paused;
+        }
+
+        [[nodiscard]]
+        double GetSpeed() const
+        {
+            return speed;
+        }
+
+        [[nodiscard]]
+        bool IsPaused() const
+        {
+            return paused;
+        }
+
+        [[nodiscard]]
+        double GetTime() const
+        {
+            return playTime / 1000.0;
+        }
+
+        [[nodiscard]]
+        bool IsPlaying() const
+        {
+            return file.is_open();
+        }
+
+        static DemoPlayer& GetInstance()
+        {
+            std::call_once(initializationFlag, [&]()
+            {
+                instance = std::unique_ptr<DemoPlayer>(new DemoPlayer());
+            });
+
+            return *instance;
+        }
+
+    private:
+
+        struct Record
+        {
+            DemoRecordKind kind;
+            std::uint64_t time;
+
+            Snapshot snapshot;
+        };
+
+        DemoPlayer() = default;
+
+        void AdvanceTo(const double target)
+        {
+            while (true)
+            {
+                if (!pendingRecord.has_value())
+                    pendingRecord = ReadRecord();
+
+                if (!pendingRecord.has_value() || static_cast<double>(pendingRecord->time) > target)
+                    return;
+
+                if (pendingRecord->kind == DemoRecordKind::Delta)
+                    ReceiverSynchronization::GetInstance().PlaySnapshot(std::move(pendingRecord->snapshot));
+
+                pendingRecord.reset();
+            }
+        }
+
+        std::optional<Record> ReadRecord()
+        {
+            if (readOffset + DemoFormat::kRecordHeaderSize > recordEnd)
+                return std::nullopt;
+
+            file.clear();
+            file.seekg(static_cast<std::streamoff>(readOffset));
+
+            Record result{};
+
+            result.kind = static_cast<DemoRecordKind>(ReadValue<std::uint8_t>());
+            result.time = ReadValue<std::uint64_t>();
+
+            const auto length = ReadValue<std::uint32_t>();
+
+            if (!file || length < sizeof(SnapshotHeader) || readOffset + DemoFormat::kRecordHeaderSize + length > recordEnd)
+                return std::nullopt;
+
+            std::vector<std::uint8_t> payload(length);
+
+            if (!file.read(reinterpret_cast<char*>(payload.data()), length))
+                return std::nullopt;
+
+            readOffset += DemoFormat::kRecordHeaderSize + length;
+
+            result.snapshot = std::any_cast<Snapshot>(DataConversion<Snapshot>::Decode(payload));
+
+            return result;
+        }
+
+        bool ReadIndex(const std::uint64_t fileSize)
+        {
+            if (fileSize < DemoFormat::kHeaderSize + DemoFormat::kTrailerSize + sizeof(std::uint32_t))
+                return false;
+
+            file.seekg(static_cast<std::streamoff>(fileSize - DemoFormat::kTrailerSize));
+
+            const auto indexOffset = ReadValue<std::uint64_t>();
+
+            if (ReadValue<std::uint32_t>() != DemoFormat::kMagic || indexOffset < DemoFormat::kHeaderSize || indexOffset + sizeof(std::uint32_t) > fileSize - DemoFormat::kTrailerSize)
+                return false;
+
+            file.seekg(static_cast<std::streamoff>(indexOffset));
+
+            const auto count = ReadValue<std::uint32_t>();
+
+            if (indexOffset + sizeof(std::uint32_t) + static_cast<std::uint64_t>(count) * sizeof(DemoIndexEntry) != fileSize - DemoFormat::kTrailerSize)
+                return false;
+
+            indexList.resize(count);
+
+            for (DemoIndexEntry& entry : indexList)
+            {
+                entry.time = ReadValue<std::uint64_t>();
+                entry.offset = ReadValue<std::uint64_t>();
+            }
+
+            recordEnd = indexOffset;
+
+            return static_cast<bool>(file);
+        }
+
+        void RebuildIndex(const std::uint64_t fileSize)
+        {
+            std::cout << "Demo has no index; scanning records." << std::endl;
+
+            indexList.clear();
+
+            std::uint64_t offset = DemoFormat::kHeaderSize;
+
+            while (offset + DemoFormat::kRecordHeaderSize <= fileSize)
+            {
+                file.clear();
+                file.seekg(static_cast<std::streamoff>(offset));
+
+                const auto kind = static_cast<DemoRecordKind>(ReadValue<std::uint8_t>());
+                const auto time = ReadValue<std::uint64_t>();
+                const auto length = ReadValue<std::uint32_t>();
+
+                if (!file || offset + DemoFormat::kRecordHeaderSize + length > fileSize)
+                    break;
+
+                if (kind == DemoRecordKind::Keyframe)
+                    indexList.push_back({ time, offset });
+
+                offset += DemoFormat::kRecordHeaderSize + length;
+            }
+
+            recordEnd = offset;
+        }
+
+        static void ResetWorld()
+        {
+            GameObjectManager::GetInstance().Clear();
+
+            ReceiverSynchronization::GetInstance().ForgetEntities();
+
+#ifndef IS_SERVER
+            ReceiverSynchronization::GetInstance().ForgetBaselines();
+#endif
+        }
+
+        template <typename T>
+        T ReadValue()
+        {
+            T value{};
+
+            file.read(reinterpret_cast<char*>(&value), sizeof(T));
+
+            return value;
+        }
+
+        std::ifstream file;
+
+        std::vector<DemoIndexEntry> indexList;
+
+        std::uint64_t readOffset{ 0 };
+        std::uint64_t recordEnd{ 0 };
+
+        std::optional<Record> pendingRecord;
+
+        double playTime{ 0.0 };
+        double speed{ 1.0 };
+
+        bool paused{ false };
+
+        static constexpr double kMinimumSpeed = 0.125;
+        static constexpr double kMaximumSpeed = 16.0;
+
+        static std::once_flag initializationFlag;
+        static std::unique_ptr<DemoPlayer> instance;
+
+    };
+
+    std::once_flag DemoPlayer::initializationFlag;
+    std::unique_ptr<DemoPlayer> DemoPlayer::instance;
+}
\ No newline at end of file
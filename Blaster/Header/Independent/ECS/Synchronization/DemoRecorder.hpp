@@ -0,0 +1,215 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+#include "Independent/ECS/Synchronization/CommonSynchronization.hpp"
+
+namespace Blaster::Independent::ECS::Synchronization
+{
+    enum class DemoRecordKind : std::uint8_t
+    {
+        Keyframe = 0,
+        Delta = 1
+    };
+
+    struct DemoIndexEntry
+    {
+        std::uint64_t time;
+        std::uint64_t offset;
+    };
+
+    struct DemoFormat
+    {
+        static constexpr std::uint32_t kMagic = 0x314D4442;
+        static constexpr std::uint32_t kVersion = 1;
+
+        static constexpr std::size_t kHeaderSize = sizeof(std::uint32_t) * 2;
+        static constexpr std::size_t kRecordHeaderSize = sizeof(std::uint8_t) + sizeof(std::uint64_t) + sizeof(std::uint32_t);
+        static constexpr std::size_t kTrailerSize = sizeof(std::uint64_t) + sizeof(std::uint32_t);
+    };
+
+    class DemoRecorder final
+    {
+
+    public:
+
+        DemoRecorder(const DemoRecorder&) = delete;
+        DemoRecorder(DemoRecorder&&) = delete;
+        DemoRecorder& operator=(const DemoRecorder&) = delete;
+        DemoRecorder& operator=(DemoRecorder&&) = delete;
+
+        ~DemoRecorder()
+        {
+            Stop();
+        }
+
+        bool Start(const std::string& path)
+        {
+            std::lock_guard guard(mutex);
+
+            if (file.is_open())
+                return false;
+
+            file.open(path, std::ios::binary | std::ios::trunc);
+
+            if (!file.is_open())
+            {
+                std::cerr << "Failed to open demo file '" << path << "' for recording." << std::endl;
+                return false;
+            }
+
+            WriteValue(DemoFormat::kMagic);
+            WriteValue(DemoFormat::kVersion);
+
+            indexList.clear();
+
+            startTime = std::chrono::steady_clock::now();
+            lastKeyframeTime.reset();
+
+            recording.store(true, std::memory_order_release);
+
+            std::cout << "Recording demo to '" << path << "'." << std::endl;
+
+            return true;
+        }
+
+        void Stop()
+        {
+            std::lock_guard guard(mutex);
+
+            if (!file.is_open())
+                return;
+
+            recording.store(false, std::memory_order_release);
+
+            const auto indexOffset = static_cast<std::uint64_t>(file.tellp());
+
+            WriteValue(static_cast<std::uint32_t>(indexList.size()));
+
+            for (const DemoIndexEntry& entry : indexList)
+            {
+                WriteValue(entry.time);
+                WriteValue(entry.offset);
+            }
+
+            WriteValue(indexOffset);
+            WriteValue(DemoFormat::kMagic);
+
+            file.close();
+
+            std::cout << "Finished demo with '" << indexList.size() << "' keyframe(s)." << std::endl;
+        }
+
+        [[nodiscard]]
+        bool IsRecording() const
+        {
+            return recording.load(std::memory_order_acquire);
+        }
+
+        [[nodiscard]]
+        bool IsKeyframeDue() const
+        {
+            if (!IsRecording())
+                return false;
+
+            std::lock_guard guard(mutex);
+
+            return !lastKeyframeTime.has_value() || std::chrono::steady_clock::now() - lastKeyframeTime.value() >= kKeyframeInterval;
+        }
+
+        void RecordKeyframe(const Snapshot& snapshot)
+        {
+            std::lock_guard guard(mutex);
+
+            if (!file.is_open())
+                return;
+
+            const auto now = std::chrono::steady_clock::now();
+
+            lastKeyframeTime = now;
+
+            indexList.push_back({ ElapsedMilliseconds(now), static_cast<std::uint64_t>(file.tellp()) });
+
+            WriteRecord(DemoRecordKind::Keyframe, now, snapshot);
+        }
+
+        void RecordDelta(const Snapshot& snapshot)
+        {
+            if (snapshot.header.operationCount == 0)
+                return;
+
+            std::lock_guard guard(mutex);
+
+            if (!file.is_open())
+                return;
+
+            WriteRecord(DemoRecordKind::Delta, std::chrono::steady_clock::now(), snapshot);
+        }
+
+        static DemoRecorder& GetInstance()
+        {
+            std::call_once(initializationFlag, [&]()
+            {
+                instance = std::unique_ptr<DemoRecorder>(new DemoRecorder());
+            });
+
+            return *instance;
+        }
+
+    private:
+
+        DemoRecorder() = default;
+
+        void WriteRecord(const DemoRecordKind kind, const std::chrono::steady_clock::time_point time, const Snapshot& snapshot)
+        {
+            std::vector<std::uint8_t> payload;
+
+            DataConversion<Snapshot>::Encode(snapshot, payload);
+
+            WriteValue(static_cast<std::uint8_t>(kind));
+            WriteValue(ElapsedMilliseconds(time));
+            WriteValue(static_cast<std::uint32_t>(payload.size()));
+
+            file.write(reinterpret_cast<const char*>(payload.data()), static_cast<std::streamsize>(payload.size()));
+        }
+
+        template <typename T>
+        void WriteValue(const T& value)
+        {
+            file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        [[nodiscard]]
+        std::uint64_t ElapsedMilliseconds(const std::chrono::steady_clock::time_point time) const
+        {
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(time - startTime).count());
+        }
+
+        std::ofstream file;
+
+        std::vector<DemoIndexEntry> indexList;
+
+        std::chrono::steady_clock::time_point startTime;
+        std::optional<std::chrono::steady_clock::time_point> lastKeyframeTime;
+
+        std::atomic<bool> recording = false;
+
+        mutable std::mutex mutex;
+
+        static constexpr std::chrono::seconds kKeyframeInterval{ 10 };
+
+        static std::once_flag initializationFlag;
+        static std::unique_ptr<DemoRecorder> instance;
+
+    };
+
+    std::once_flag DemoRecorder::initializationFlag;
+    std::unique_ptr<DemoRecorder> DemoRecorder::instance;
+}
\ No newline at end of file
@@ -0,0 +1,196 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "Independent/Network/CommonNetwork.hpp"
+
+using namespace Blaster::Independent::Network;
+
+namespace Blaster::Independent::ECS::Synchronization
+{
+    using EntityId = std::uint32_t;
+
+    struct EntityReference
+    {
+        EntityId id{ 0 };
+
+        std::string path;
+    };
+
+    class NetworkEntityTable final
+    {
+
+    public:
+
+        NetworkEntityTable(const NetworkEntityTable&) = delete;
+        NetworkEntityTable(NetworkEntityTable&&) = delete;
+        NetworkEntityTable& operator=(const NetworkEntityTable&) = delete;
+        NetworkEntityTable& operator=(NetworkEntityTable&&) = delete;
+
+        EntityId Assign(const std::string& path)
+        {
+            std::unique_lock guard(mutex);
+
+            if (const auto hit = idMap.find(path); hit != idMap.end())
+                return hit->second;
+
+            const EntityId id = ++lastAssignedId;
+
+            BindLocked(id, path);
+
+            return id;
+        }
+
+        void Bind(const EntityId id, const std::string& path)
+        {
+            if (id == 0)
+                return;
+
+            std::unique_lock guard(mutex);
+
+            BindLocked(id, path);
+        }
+
+        [[nodiscard]]
+        std::optional<EntityId> FindId(const std::string& path) const
+        {
+            std::shared_lock guard(mutex);
+
+            const auto hit = idMap.find(path);
+
+            return hit == idMap.end() ? std::nullopt : std::make_optional(hit->second);
+        }
+
+        [[nodiscard]]
+        std::optional<std::string> FindPath(const EntityId id) const
+        {
+            std::shared_lock guard(mutex);
+
+            const auto hit = pathMap.find(id);
+
+            return hit == pathMap.end() ? std::nullopt : std::make_optional(hit->second);
+        }
+
+        void ForgetPath(const std::string& path)
+        {
+            std::unique_lock guard(mutex);
+
+            const std::string prefix = path + ".";
+
+            std::erase_if(idMap, [&](const auto& entry)
+                {
+                    if (entry.first != path && !entry.first.starts_with(prefix))
+                        return false;
+
+                    pathMap.erase(entry.second);
+
+                    return true;
+                });
+        }
+
+        void Clear()
+        {
+            std::unique_lock guard(mutex);
+
+            idMap.clear();
+            pathMap.clear();
+        }
+
+        static void WriteReference(std::vector<std::uint8_t>& buffer, const EntityId id, const std::string& path)
+        {
+            CommonNetwork::WriteTrivial(buffer, id);
+
+            if (id == 0)
+                CommonNetwork::EncodeString(buffer, path);
+        }
+
+        static std::size_t GetReferenceSize(const EntityId id, const std::string& path)
+        {
+            return id == 0 ? sizeof(EntityId) + sizeof(std::uint32_t) + path.size() : sizeof(EntityId);
+        }
+
+        [[nodiscard]]
+        EntityReference DecodeReference(const std::span<const std::uint8_t> bytes, std::size_t& offset) const
+        {
+            EntityReference reference = ReadReference(bytes, offset);
+
+            Resolve(reference.id, reference.path);
+
+            return reference;
+        }
+
+        bool Resolve(const EntityId id, std::string& path) const
+        {
+            if (!path.empty())
+                return true;
+
+            if (auto found = FindPath(id); found.has_value())
+            {
+                path = std::move(found.value());
+                return true;
+            }
+
+            std::cerr << "Entity id '" << id << "' is not bound on this end; dropping the operation that references it." << std::endl;
+
+            return false;
+        }
+
+        static EntityReference ReadReference(const std::span<const std::uint8_t> bytes, std::size_t& offset)
+        {
+            const EntityId id = CommonNetwork::ReadTrivial<EntityId>(bytes, offset);
+
+            if (id == 0)
+                return { 0, CommonNetwork::DecodeString(bytes, offset) };
+
+            return { id, {} };
+        }
+
+        static NetworkEntityTable& GetInstance()
+        {
+            std::call_once(initializationFlag, [&]()
+            {
+                instance = std::unique_ptr<NetworkEntityTable>(new NetworkEntityTable());
+            });
+
+            return *instance;
+        }
+
+    private:
+
+        NetworkEntityTable() = default;
+
+        void BindLocked(const EntityId id, const std::string& path)
+        {
+            if (const auto previous = pathMap.find(id); previous != pathMap.end() && previous->second != path)
+                idMap.erase(previous->second);
+
+            if (const auto previous = idMap.find(path); previous != idMap.end() && previous->second != id)
+                pathMap.erase(previous->second);
+
+            idMap[path] = id;
+            pathMap[id] = path;
+        }
+
+        std::unordered_map<std::string, EntityId> idMap;
+        std::unordered_map<EntityId, std::string> pathMap;
+
+        EntityId lastAssignedId{ 0 };
+
+        mutable std::shared_mutex mutex;
+
+        static std::once_flag initializationFlag;
+        static std::unique_ptr<NetworkEntityTable> instance;
+
+    };
+
+    std::once_flag NetworkEntityTable::initializationFlag;
+    std::unique_ptr<NetworkEntityTable> NetworkEntityTable::instance;
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include "Independent/ECS/Synchronization/NetworkEntityTable.hpp"
+
+namespace Blaster::Independent::ECS::Synchronization
+{
+    class PeerEntityBindings final
+    {
+
+    public:
+
+        PeerEntityBindings() = default;
+
+        PeerEntityBindings(const PeerEntityBindings&) = delete;
+        PeerEntityBindings(PeerEntityBindings&&) = delete;
+        PeerEntityBindings& operator=(const PeerEntityBindings&) = delete;
+        PeerEntityBindings& operator=(PeerEntityBindings&&) = delete;
+
+        void Record(const std::string& path, const EntityId id, const std::uint64_t sequence)
+        {
+            if (id == 0)
+                return;
+
+            const auto [iterator, inserted] = bindingMap.try_emplace(path, Binding{ id, sequence });
+
+            if (!inserted && iterator->second.id != id)
+                iterator->second = { id, sequence };
+        }
+
+        [[nodiscard]]
+        bool IsBound(const std::string& path, const EntityId id, const std::uint64_t ackedSequence) const
+        {
+            if (id == 0)
+                return false;
+
+            const auto hit = bindingMap.find(path);
+
+            return hit != bindingMap.end() && hit->second.id == id && hit->second.sequence <= ackedSequence;
+        }
+
+        void ForgetPath(const std::string& path)
+        {
+            const std::string prefix = path + ".";
+
+            std::erase_if(bindingMap, [&](const auto& entry) { return entry.first == path || entry.first.starts_with(prefix); });
+        }
+
+        void Clear()
+        {
+            bindingMap.clear();
+        }
+
+    private:
+
+        struct Binding
+        {
+            EntityId id{ 0 };
+
+            std::uint64_t sequence{ 0 };
+        };
+
+        std::unordered_map<std::string, Binding> bindingMap;
+
+    };
+}
\ No newline at end of file
@@ -2,13 +2,19 @@
 
 #include <unordered_set>
 #include <queue>
-#include <sstream>
+#include <spanstream>
 #include <string_view>
+#include <variant>
 #include <boost/archive/text_iarchive.hpp>
 #include <boost/mp11.hpp>
+#include "Independent/ECS/Synchronization/BaselineRing.hpp"
+#include "Independent/ECS/Synchronization/ComponentStateCodec.hpp"
+#include "Independent/ECS/Synchronization/DemoRecorder.hpp"
+#include "Independent/ECS/Synchronization/NetworkEntityTable.hpp"
 #include "Independent/ECS/Synchronization/SenderSynchronization.hpp"
 #include "Independent/ECS/Synchronization/SyncTracker.hpp"
 #include "Independent/ECS/Synchronization/TranslationBuffer.hpp"
+#include "Independent/ECS/ComponentPool.hpp"
 #include "Independent/ECS/GameObjectManager.hpp"
 
 using namespace Blaster::Independent::ECS;
@@ -16,6 +22,24 @@ using namespace Blaster::Independent::Network;
 
 namespace Blaster::Independent::ECS::Synchronization
 {
+    struct PreparedOperation
+    {
+        std::variant<OpCreate, OpDestroy, OpAddComponent, OpRemoveComponent, OpSetField, OpSpawn> operation;
+
+        std::shared_ptr<Component> component;
+
+        std::shared_ptr<const std::vector<std::uint8_t>> baseline;
+    };
+
+    struct PreparedSnapshot
+    {
+        Snapshot snapshot;
+
+        std::vector<PreparedOperation> operationList;
+
+        std::optional<Snapshot> demoSnapshot;
+    };
+
     struct SnapshotApplyGuard
     {
         SnapshotApplyGuard()
@@ -56,15 +80,59 @@ namespace Blaster::Independent::ECS::Synchronization
         ReceiverSynchronization& operator=(ReceiverSynchronization&&) = delete;
 
         void HandleSnapshotPayload(std::vector<std::uint8_t> payload)
+        {
+            std::optional<PreparedSnapshot> prepared = PrepareSnapshot(std::move(payload));
+
+            if (prepared.has_value())
+                ApplyPrepared(prepared.value());
+        }
+
+        void EnqueueSnapshotPayload(std::vector<std::uint8_t> payload)
+        {
+            std::optional<PreparedSnapshot> prepared = PrepareSnapshot(std::move(payload));
+
+            if (!prepared.has_value())
+                return;
+
+            MainThreadExecutor::GetInstance().EnqueueTask(nullptr, [this, prepared = std::make_shared<PreparedSnapshot>(std::move(prepared.value()))]
+                {
+                    ApplyPrepared(*prepared);
+                });
+        }
+
+        std::optional<PreparedSnapshot> PrepareSnapshot(std::vector<std::uint8_t> payload)
         {
             std::span<std::uint8_t> packet(payload.data(), payload.size());
             std::vector<std::any> anyList = CommonNetwork::DisassembleData(packet);
 
             if (anyList.empty())
-                return;
+                return std::nullopt;
+
+            Snapshot snapshot = std::any_cast<Snapshot>(std::move(anyList.front()));
+
+            if (snapshot.header.sequence <= SyncTracker::GetInstance().GetLastIncoming(snapshot.header.origin))
+                return std::nullopt;
+
+#ifdef IS_SERVER
+            constexpr bool recordDemo = false;
+#else
+            const bool recordDemo = DemoRecorder::GetInstance().IsRecording();
+#endif
+
+            return PrepareDecoded(std::move(snapshot), recordDemo);
+        }
+
+        void PlaySnapshot(Snapshot snapshot)
+        {
+            PreparedSnapshot prepared = PrepareDecoded(std::move(snapshot), false);
+
+            ApplySnapshot(prepared);
+        }
+
+        void ApplyPrepared(PreparedSnapshot& prepared)
+        {
+            Snapshot& snapshot = prepared.snapshot;
 
-            Snapshot snapshot = std::any_cast<Snapshot>(anyList.front());
-             
             if (snapshot.header.sequence <= SyncTracker::GetInstance().GetLastIncoming(snapshot.header.origin))
                 return;
 
@@ -75,27 +143,78 @@ namespace Blaster::Independent::ECS::Synchronization
             
             std::cout << "Received packet from source '" << snapshot.header.origin << "' with route '" << (int)snapshot.header.route << "' with ack '" << snapshot.header.ack << "'!" << std::endl;
 
-            ApplySnapshot(snapshot);
+#ifdef IS_SERVER
+            snapshot.header.tick = SnapshotScheduler::GetInstance().GetTick();
+#endif
+
+            ApplySnapshot(prepared);
+
+            if (prepared.demoSnapshot.has_value())
+                DemoRecorder::GetInstance().RecordDelta(prepared.demoSnapshot.value());
 
             SyncTracker::GetInstance().MarkDelivered(snapshot.header.origin, snapshot.header.sequence);
             SyncTracker::GetInstance().MarkAck(snapshot.header.origin, snapshot.header.ack);
 
 #ifdef IS_SERVER
+            Blaster::Server::Network::CongestionController::GetInstance().OnAck(snapshot.header.origin, snapshot.header.ack);
+
             if (snapshot.header.route == Route::RelayOnce)
             {
                 snapshot.header.route = Route::ServerBroadcast;
 
                 std::cout << "Sent packet containing '" << snapshot.header.operationCount << "' operation(s) to all clients EXCEPT '" << snapshot.header.origin << "'!" << std::endl;
 
-                for (NetworkId id : Blaster::Server::Network::ServerNetwork::GetInstance().GetConnectedClients())
+                for (NetworkId id : SenderSynchronization::GetSessionClients())
                 {
-                    if (id != snapshot.header.origin)
-                        Blaster::Server::Network::ServerNetwork::GetInstance().SendTo(id, PacketType::S2C_Snapshot, snapshot);
+                    if (id == snapshot.header.origin)
+                        continue;
+
+                    Blaster::Server::Network::ServerNetwork::GetInstance().SendTo(id, PacketType::S2C_Snapshot, snapshot);
+                    SyncTracker::GetInstance().RecordOutgoing(id, snapshot, true);
                 }
             }
 #endif
         }
 
+#ifdef IS_SERVER
+        void ApplyHandoff(Snapshot snapshot, const std::optional<NetworkId>& owner)
+        {
+            snapshot.header.origin = 0;
+            snapshot.header.tick = SnapshotScheduler::GetInstance().GetTick();
+
+            PreparedSnapshot prepared = PrepareDecoded(std::move(snapshot), false);
+
+            for (auto& operation : prepared.operationList)
+            {
+                std::visit([&owner](auto& decoded)
+                    {
+                        using Operation = std::decay_t<decltype(decoded)>;
+
+                        decoded.entityId = 0;
+
+                        if constexpr (std::is_same_v<Operation, OpCreate> || std::is_same_v<Operation, OpSpawn>)
+                            decoded.owner = owner;
+                    }, operation.operation);
+            }
+
+            ApplySnapshot(prepared);
+        }
+#endif
+
+#ifndef IS_SERVER
+        void ForgetBaselines()
+        {
+            baselineRing.Clear();
+        }
+#endif
+
+        void ForgetEntities()
+        {
+            NetworkEntityTable::GetInstance().Clear();
+
+            entityCacheMap.clear();
+        }
+
         static ReceiverSynchronization& GetInstance()
         {
             std::call_once(initializationFlag, [&]()
@@ -110,15 +229,21 @@ namespace Blaster::Independent::ECS::Synchronization
 
         ReceiverSynchronization() = default;
 
-        void ApplySnapshot(const Snapshot& snapshot)
+        PreparedSnapshot PrepareDecoded(Snapshot snapshot, const bool recordDemo)
         {
-            SnapshotApplyGuard guard;
+            PreparedSnapshot result;
 
-            std::span<const std::uint8_t> blob(snapshot.operationBlob.data(), snapshot.operationBlob.size());
+            result.snapshot = std::move(snapshot);
+
+            std::span<const std::uint8_t> blob(result.snapshot.operationBlob.data(), result.snapshot.operationBlob.size());
 
             std::size_t offset = 0;
 
-            for (std::uint32_t i = 0; i < snapshot.header.operationCount; ++i)
+            result.operationList.reserve(result.snapshot.header.operationCount);
+
+            Snapshot demoSnapshot{ result.snapshot.header, {} };
+
+            for (std::uint32_t i = 0; i < result.snapshot.header.operationCount; ++i)
             {
                 if (offset + 5 > blob.size())
                     break;
@@ -136,67 +261,214 @@ namespace Blaster::Independent::ECS::Synchronization
 
                 offset += length;
 
-                ApplyOperation(code, slice, (snapshot.header.origin != 0));
+                std::optional<PreparedOperation> operation = PrepareOperation(code, slice, result.snapshot.header, recordDemo ? &demoSnapshot.operationBlob : nullptr);
+
+                if (!operation.has_value())
+                    continue;
+
+                if (recordDemo && code != OpCode::DeltaField)
+                    AppendDemoOperation(demoSnapshot.operationBlob, code, slice);
+
+                result.operationList.push_back(std::move(operation.value()));
             }
+
+            if (recordDemo)
+            {
+                demoSnapshot.header.operationCount = static_cast<std::uint32_t>(result.operationList.size());
+
+                result.demoSnapshot = std::move(demoSnapshot);
+            }
+
+            return result;
+        }
+
+        static void AppendDemoOperation(std::vector<std::uint8_t>& destination, const OpCode code, const std::span<const std::uint8_t> slice)
+        {
+            CommonNetwork::WriteTrivial(destination, static_cast<std::uint8_t>(code));
+            CommonNetwork::WriteTrivial(destination, static_cast<std::uint32_t>(slice.size()));
+            CommonNetwork::WriteRaw(destination, slice.data(), slice.size());
         }
 
-        void ApplyOperation(OpCode code, std::span<const std::uint8_t> slice, bool fromClient)
+        std::optional<PreparedOperation> PrepareOperation(OpCode code, std::span<const std::uint8_t> slice, const SnapshotHeader& header, std::vector<std::uint8_t>* demoBlob)
         {
             switch (code)
             {
 
             case OpCode::Create:
-                HandleCreate(slice, fromClient);
-                break;
+                return PreparedOperation{ std::any_cast<OpCreate>(DataConversion<OpCreate>::Decode(slice)), nullptr };
+
+            case OpCode::Spawn:
+                return PreparedOperation{ std::any_cast<OpSpawn>(DataConversion<OpSpawn>::Decode(slice)), nullptr };
 
             case OpCode::Destroy:
-                HandleDestroy(slice, fromClient);
-                break;
+                return PreparedOperation{ std::any_cast<OpDestroy>(DataConversion<OpDestroy>::Decode(slice)), nullptr };
 
             case OpCode::AddComponent:
-                HandleAddComponent(slice, fromClient);
-                break;
+            {
+                OpAddComponent operation = std::any_cast<OpAddComponent>(DataConversion<OpAddComponent>::Decode(slice));
+
+                if (ComponentFactory::DeserializesOnMainThread(operation.componentType))
+                    return PreparedOperation{ std::move(operation), nullptr };
+
+                std::shared_ptr<Component> component = DeserializeDetached(operation.blob);
+
+                operation.blob.clear();
+
+                return PreparedOperation{ std::move(operation), std::move(component) };
+            }
 
             case OpCode::RemoveComponent:
-                HandleRemoveComponent(slice, fromClient);
-                break;
+                return PreparedOperation{ std::any_cast<OpRemoveComponent>(DataConversion<OpRemoveComponent>::Decode(slice)), nullptr };
 
             case OpCode::SetField:
-                HandleSetField(slice, fromClient);
-                break;
+                return PrepareSetField(std::any_cast<OpSetField>(DataConversion<OpSetField>::Decode(slice)), header);
+
+#ifndef IS_SERVER
+            case OpCode::DeltaField:
+            {
+                OpDeltaField delta = std::any_cast<OpDeltaField>(DataConversion<OpDeltaField>::Decode(slice));
+
+                if (!NetworkEntityTable::GetInstance().Resolve(delta.entityId, delta.path))
+                    return std::nullopt;
+
+                const std::string key = BaselineRing::MakeKey(delta.path, delta.componentType);
+
+                const auto baseline = baselineRing.Find(key, delta.baseline);
+
+                std::optional<std::vector<std::uint8_t>> blob = baseline ? BaselineRing::DecodeDelta(*baseline, delta.blob) : std::nullopt;
+
+                if (!blob.has_value())
+                {
+                    std::cerr << "Missing or corrupt baseline '" << delta.baseline << "' for '" << key << "'; requesting full state." << std::endl;
+
+                    Blaster::Client::Network::ClientNetwork::GetInstance().Send(PacketType::C2S_BaselineMiss, BaselineMiss{ delta.path, delta.componentType, delta.baseline });
+
+                    return std::nullopt;
+                }
+
+                OpSetField operation{ delta.path, delta.componentType, 0, std::move(blob.value()), delta.entityId };
+
+                if (demoBlob != nullptr)
+                {
+                    std::vector<std::uint8_t> encoded;
+
+                    DataConversion<OpSetField>::Encode(operation, encoded);
+
+                    AppendDemoOperation(*demoBlob, OpCode::SetField, encoded);
+                }
+
+                return PrepareSetField(std::move(operation), header);
+            }
+#endif
 
             default:
-                std::cerr << "Invalid opCode '" << (int)code << "' at ReceiverSynchronization::ApplyOperation." << std::endl;
-                break;
+                std::cerr << "Invalid opCode '" << (int)code << "' at ReceiverSynchronization::PrepareOperation." << std::endl;
+                return std::nullopt;
             }
+        }
+
+        PreparedOperation PrepareSetField(OpSetField operation, const SnapshotHeader& header)
+        {
+            std::shared_ptr<const std::vector<std::uint8_t>> baseline;
 
-            std::cout << "Applied opCode '" << (int)code << "', fromClient was '" << fromClient << "'!" << std::endl;
+#ifndef IS_SERVER
+            if (operation.fieldMask == 0 && header.origin == 0)
+                baseline = std::make_shared<const std::vector<std::uint8_t>>(operation.blob);
+#endif
+
+            if (operation.fieldMask != 0 || ComponentFactory::DeserializesOnMainThread(operation.componentType))
+                return PreparedOperation{ std::move(operation), nullptr, std::move(baseline) };
+
+            std::shared_ptr<Component> component = DeserializePooled(operation.componentType, operation.blob);
+
+            operation.blob.clear();
+
+            return PreparedOperation{ std::move(operation), std::move(component), std::move(baseline) };
         }
 
-        void HandleCreate(std::span<const std::uint8_t> slice, bool fromClient)
+        void ApplySnapshot(PreparedSnapshot& prepared)
         {
-            OpCreate operation = std::any_cast<OpCreate>(DataConversion<OpCreate>::Decode(slice));
+            SnapshotApplyGuard guard;
+
+            const bool fromClient = prepared.snapshot.header.origin != 0;
+
+            currentTick = prepared.snapshot.header.tick;
 
+#ifndef IS_SERVER
+            if (!fromClient)
+                SnapshotScheduler::GetInstance().ObserveServerTick(currentTick);
+#endif
+
+            for (auto& operation : prepared.operationList)
+                ApplyOperation(operation, prepared.snapshot.header.sequence, fromClient);
+        }
+
+        void ApplyOperation(PreparedOperation& prepared, const std::uint64_t sequence, bool fromClient)
+        {
+            std::visit([&](auto& operation)
+                {
+                    using Operation = std::decay_t<decltype(operation)>;
+
+                    if constexpr (std::is_same_v<Operation, OpCreate> || std::is_same_v<Operation, OpSpawn>)
+                        NetworkEntityTable::GetInstance().Bind(operation.entityId, operation.path);
+                    else if (!NetworkEntityTable::GetInstance().Resolve(operation.entityId, operation.path))
+                        return;
+
+                    if constexpr (std::is_same_v<Operation, OpDestroy>)
+                    {
+                        NetworkEntityTable::GetInstance().ForgetPath(operation.path);
+
+#ifndef IS_SERVER
+                        baselineRing.ForgetPath(operation.path);
+#endif
+                    }
+
+#ifndef IS_SERVER
+                    if constexpr (std::is_same_v<Operation, OpSetField>)
+                    {
+                        if (prepared.baseline)
+                            baselineRing.Record(BaselineRing::MakeKey(operation.path, operation.componentType), sequence, std::move(prepared.baseline));
+                    }
+#endif
+
+                    if constexpr (std::is_same_v<Operation, OpAddComponent>)
+                    {
+                        if (!prepared.component && !operation.blob.empty())
+                            prepared.component = DeserializeDetached(operation.blob);
+                    }
+                    else if constexpr (std::is_same_v<Operation, OpSetField>)
+                    {
+                        if (!prepared.component && !operation.blob.empty() && operation.fieldMask == 0)
+                            prepared.component = DeserializePooled(operation.componentType, operation.blob);
+                    }
+
+                    if constexpr (std::is_same_v<Operation, OpCreate>)
+                        HandleCreate(operation, fromClient);
+                    else if constexpr (std::is_same_v<Operation, OpDestroy>)
+                        HandleDestroy(operation, fromClient);
+                    else if constexpr (std::is_same_v<Operation, OpAddComponent>)
+                        HandleAddComponent(operation, prepared.component, fromClient);
+                    else if constexpr (std::is_same_v<Operation, OpRemoveComponent>)
+                        HandleRemoveComponent(operation, fromClient);
+                    else if constexpr (std::is_same_v<Operation, OpSpawn>)
+                        HandleSpawn(operation, fromClient);
+                    else if constexpr (std::is_same_v<Operation, OpSetField>)
+                    {
+                        HandleSetField(operation, prepared.component, fromClient);
+
+                        ComponentPool::GetInstance().Release(operation.componentType, std::move(prepared.component));
+                    }
+                }, prepared.operation);
+        }
+
+        void HandleCreate(const OpCreate& operation, bool fromClient)
+        {
             const std::string& path = operation.path;
 
             if (GameObjectManager::GetInstance().Has(path)) //TODO: Very hacky, fix this
                 return;
 
-            std::string parentPath;
-            std::string objectName;
-
-            std::size_t dotPosition = path.find_last_of('.');
-
-            if (dotPosition == std::string::npos)
-            {
-                parentPath = ".";
-                objectName = path;
-            }
-            else
-            {
-                parentPath = path.substr(0, dotPosition);
-                objectName = path.substr(dotPosition + 1);
-            }
+            const auto [parentPath, objectName] = SplitParentPath(path);
             
             auto gameObject = GameObject::Create(objectName, false, operation.owner);
             
@@ -209,56 +481,109 @@ namespace Blaster::Independent::ECS::Synchronization
 #endif
         }
 
-        void HandleDestroy(std::span<const std::uint8_t> slice, bool fromClient)
+        void HandleSpawn(const OpSpawn& operation, bool fromClient)
+        {
+            if (GameObjectManager::GetInstance().Has(operation.path))
+                return;
+
+            const auto prefab = PrefabManager::GetInstance().Get(operation.prefabId);
+
+            if (!prefab.has_value())
+            {
+                std::cerr << "Cannot spawn '" << operation.path << "'; prefab '" << operation.prefabId << "' is not registered on this end!" << std::endl;
+                return;
+            }
+
+            const auto [parentPath, objectName] = SplitParentPath(operation.path);
+
+#ifndef IS_SERVER
+            const bool markDirty = fromClient;
+#else
+            const bool markDirty = !fromClient;
+#endif
+
+            const auto root = GameObjectManager::GetInstance().Instantiate(*prefab.value(), objectName, parentPath, operation.owner, operation.overrideList, {}, markDirty);
+
+            if (!root)
+                return;
+
+            if (operation.entityId != 0)
+                entityCacheMap[operation.entityId] = root;
+
+            for (const PrefabNode& node : prefab.value()->GetNodeList())
+            {
+                const auto member = node.relativePath.empty() ? std::make_optional(root) : GameObjectManager::GetInstance().Get(operation.path + "." + node.relativePath);
+
+                if (!member.has_value())
+                    continue;
+
+                member.value()->ClearJustCreated();
+
+                for (const auto& component : member.value()->GetComponentOrder())
+                {
+                    component->ClearWasAdded();
+
+                    SenderSynchronization::GetInstance().RememberHash(component);
+                }
+            }
+        }
+
+        static std::pair<std::string, std::string> SplitParentPath(const std::string& path)
+        {
+            const std::size_t dotPosition = path.find_last_of('.');
+
+            if (dotPosition == std::string::npos)
+                return { ".", path };
+
+            return { path.substr(0, dotPosition), path.substr(dotPosition + 1) };
+        }
+
+        void HandleDestroy(const OpDestroy& operation, bool fromClient)
         {
-            OpDestroy operation = std::any_cast<OpDestroy>(DataConversion<OpDestroy>::Decode(slice));
+            entityCacheMap.erase(operation.entityId);
 
             GameObjectManager::GetInstance().Unregister(operation.path);
         }
 
-        void HandleAddComponent(const std::span<const std::uint8_t> slice, bool fromClient)
+        void HandleAddComponent(const OpAddComponent& operation, std::shared_ptr<Component>& incoming, bool fromClient)
         {
-            auto [path, componentType, blob] = std::any_cast<OpAddComponent>(DataConversion<OpAddComponent>::Decode(slice));
+            if (!incoming)
+                return;
 
-            auto gameObjectOptional = GameObjectManager::GetInstance().Get(path);
+            auto gameObjectOptional = ResolveGameObject(operation.entityId, operation.path);
 
             if (!gameObjectOptional)
                 return;
 
-            if (gameObjectOptional.value()->HasComponentDynamic(TypeRegistrar::GetRuntimeName(componentType)))
+            if (gameObjectOptional.value()->HasComponentDynamic(TypeRegistrar::GetRuntimeName(operation.componentType)))
             {
-                auto& existing = *gameObjectOptional.value()->UnsafeFindComponentPointer(TypeRegistrar::GetRuntimeName(componentType));
+                auto& existing = *gameObjectOptional.value()->UnsafeFindComponentPointer(TypeRegistrar::GetRuntimeName(operation.componentType));
 
                 if (typeid(*existing) == typeid(Transform3d))
                 {
-                    std::shared_ptr<Component> fresh = ComponentFactory::Instantiate(componentType);
-
-                    DeserializeInto(fresh, blob);
+                    std::shared_ptr<Transform3d> transform = std::static_pointer_cast<Transform3d>(incoming);
 
-                    std::shared_ptr<Transform3d> incoming = std::static_pointer_cast<Transform3d>(fresh);
-
-                    std::static_pointer_cast<Transform3d>(existing)->SetLocalPosition(incoming->GetLocalPosition(), false);
-                    std::static_pointer_cast<Transform3d>(existing)->SetLocalRotation(incoming->GetLocalRotation(), false);
-                    std::static_pointer_cast<Transform3d>(existing)->SetLocalScale(incoming->GetLocalScale(), false);
+                    std::static_pointer_cast<Transform3d>(existing)->SetLocalPosition(transform->GetLocalPosition(), false);
+                    std::static_pointer_cast<Transform3d>(existing)->SetLocalRotation(transform->GetLocalRotation(), false);
+                    std::static_pointer_cast<Transform3d>(existing)->SetLocalScale(transform->GetLocalScale(), false);
 
                     existing->ClearWasAdded();
                     SenderSynchronization::GetInstance().RememberHash(existing);
+
+#ifndef IS_SERVER
+                    transformMirrorMap[existing.get()] = { existing, transform };
+#endif
                 }
                 else
                 {
-                    DeserializeIntoMerge(existing, blob);
+                    MergeSupport::MergeComponents(existing, incoming);
                     SenderSynchronization::GetInstance().RememberHash(existing);
                 }
 
                 return;
             }
 
-            std::shared_ptr<Component> fresh = ComponentFactory::Instantiate(componentType);
-
-            if (!fresh)
-                return;
-
-            DeserializeInto(fresh, blob);
+            std::shared_ptr<Component> fresh = std::move(incoming);
 
             fresh->ClearWasAdded();
 
@@ -271,17 +596,42 @@ namespace Blaster::Independent::ECS::Synchronization
 #endif
         }
 
-        void HandleRemoveComponent(std::span<const std::uint8_t> slice, bool fromClient)
+        std::optional<std::shared_ptr<GameObject>> ResolveGameObject(const EntityId entityId, const std::string& path)
         {
-            OpRemoveComponent operation = std::any_cast<OpRemoveComponent>(DataConversion<OpRemoveComponent>::Decode(slice));
+            if (entityId != 0)
+            {
+                if (const auto hit = entityCacheMap.find(entityId); hit != entityCacheMap.end())
+                {
+                    if (auto gameObject = hit->second.lock(); gameObject && !gameObject->IsDestroyed())
+                        return gameObject;
+                }
+            }
+
+            auto result = GameObjectManager::GetInstance().Get(path);
+
+            if (result.has_value() && entityId != 0)
+                entityCacheMap[entityId] = result.value();
+
+            return result;
+        }
 
-            auto gameObjectOptional = GameObjectManager::GetInstance().Get(operation.path);
+        void HandleRemoveComponent(const OpRemoveComponent& operation, bool fromClient)
+        {
+            auto gameObjectOptional = ResolveGameObject(operation.entityId, operation.path);
 
             if (!gameObjectOptional.has_value())
                 return;
 
             if (gameObjectOptional.value()->HasComponentDynamic(TypeRegistrar::GetRuntimeName(operation.componentType)))
-                SenderSynchronization::GetInstance().ForgetHash(*gameObjectOptional.value()->GetComponentDynamic(TypeRegistrar::GetRuntimeName(operation.componentType)));
+            {
+                const auto component = *gameObjectOptional.value()->GetComponentDynamic(TypeRegistrar::GetRuntimeName(operation.componentType));
+
+                SenderSynchronization::GetInstance().ForgetHash(component);
+
+#ifndef IS_SERVER
+                transformMirrorMap.erase(component.get());
+#endif
+            }
 
 #ifndef IS_SERVER
             gameObjectOptional.value()->RemoveComponentDynamic(TypeRegistrar::GetRuntimeName(operation.componentType), fromClient);
@@ -290,11 +640,12 @@ namespace Blaster::Independent::ECS::Synchronization
 #endif
         }
 
-        void HandleSetField(std::span<const std::uint8_t> slice, bool fromClient)
+        void HandleSetField(const OpSetField& operation, const std::shared_ptr<Component>& incoming, bool fromClient)
         {
-            OpSetField operation = std::any_cast<OpSetField>(DataConversion<OpSetField>::Decode(slice));
+            if (!incoming && operation.fieldMask == 0)
+                return;
 
-            auto gameObjectOptional = GameObjectManager::GetInstance().Get(operation.path);
+            auto gameObjectOptional = ResolveGameObject(operation.entityId, operation.path);
 
             if (gameObjectOptional && gameObjectOptional.value()->IsLocallyControlled())
                 return;
@@ -302,14 +653,29 @@ namespace Blaster::Independent::ECS::Synchronization
 #ifndef IS_SERVER
             if (operation.componentType == TypeRegistrar::GetTypeId<Blaster::Independent::Math::Transform3d>())
             {
-                std::shared_ptr<Component> fresh = ComponentFactory::Instantiate(operation.componentType);
+                if (!gameObjectOptional)
+                    return;
+
+                const auto existing = std::static_pointer_cast<Transform3d>(*gameObjectOptional.value()->UnsafeFindComponentPointer(TypeRegistrar::GetRuntimeName(operation.componentType)));
 
-                DeserializeInto(fresh, operation.blob);
+                std::shared_ptr<Transform3d> temporary = MirrorTransform(existing);
 
-                std::shared_ptr<Transform3d> temporary = std::static_pointer_cast<Transform3d>(fresh);
+                if (!temporary)
+                    return;
+
+                if (operation.fieldMask == 0)
+                {
+                    std::shared_ptr<Component> target = temporary;
 
-                if (gameObjectOptional)
-                    TranslationBuffer::GetInstance().Enqueue(std::static_pointer_cast<Transform3d>(*gameObjectOptional.value()->UnsafeFindComponentPointer(TypeRegistrar::GetRuntimeName(operation.componentType))), temporary->GetLocalPosition(), temporary->GetLocalRotation(), temporary->GetLocalScale());
+                    MergeSupport::MergeComponents(target, incoming);
+                }
+                else if (!MergeSupport::ApplyFields(temporary, operation.fieldMask, operation.blob))
+                {
+                    std::cerr << "Corrupt field payload for '" << operation.path << "'\n";
+                    return;
+                }
+
+                TranslationBuffer::GetInstance().Enqueue(existing, currentTick, temporary->GetLocalPosition(), temporary->GetLocalRotation(), temporary->GetLocalScale(), temporary->GetLinearVelocity(), temporary->GetAngularVelocity());
                 
                 return;
             }
@@ -323,53 +689,81 @@ namespace Blaster::Independent::ECS::Synchronization
             if (!componentOptional)
                 return;
 
-            DeserializeIntoMerge(*componentOptional, operation.blob);
+            if (operation.fieldMask != 0)
+            {
+                if (!MergeSupport::ApplyFields(*componentOptional, operation.fieldMask, operation.blob))
+                {
+                    std::cerr << "Corrupt field payload for '" << operation.path << "'\n";
+                    return;
+                }
+            }
+            else
+                MergeSupport::MergeComponents(*componentOptional, incoming);
 
             SenderSynchronization::GetInstance().RememberHash(*componentOptional);
         }
 
-        template <typename T>
-        void DeserializeInto(std::shared_ptr<T>& destination, const std::vector<std::uint8_t>& blob)
+#ifndef IS_SERVER
+        std::shared_ptr<Transform3d> MirrorTransform(const std::shared_ptr<Transform3d>& existing)
         {
-            std::string text(blob.begin(), blob.end());
-            std::istringstream stream(text);
+            std::erase_if(transformMirrorMap, [](const auto& entry) { return entry.second.source.expired(); });
 
-            boost::archive::text_iarchive archive(stream);
+            TransformMirror& mirror = transformMirrorMap[existing.get()];
+
+            if (mirror.source.lock() != existing || !mirror.target)
+                mirror = { existing, std::static_pointer_cast<Transform3d>(DeserializeDetached(CommonNetwork::SerializePointerToBlob(existing))) };
 
-            std::shared_ptr<T> temporary;
+            return mirror.target;
+        }
+#endif
 
-            archive >> temporary;
+        static std::shared_ptr<Component> DeserializePooled(const std::uint64_t componentType, const std::vector<std::uint8_t>& blob)
+        {
+            std::shared_ptr<Component> result = ComponentPool::GetInstance().Acquire(componentType);
 
-            if (!temporary)
+            if (!result || !ComponentStateCodec::DecodeInto(componentType, blob, *result))
             {
                 std::cerr << "Corrupt payload\n";
-                return;
-            }
 
-            temporary->gameObject = destination->GetGameObject();
+                return nullptr;
+            }
 
-            destination = std::move(temporary);
+            return result;
         }
 
-        template <typename T>
-        void DeserializeIntoMerge(std::shared_ptr<T>& destination, std::span<const std::uint8_t> blob)
+        static std::shared_ptr<Component> DeserializeDetached(const std::vector<std::uint8_t>& blob)
         {
-            std::string_view view{ reinterpret_cast<const char*>(blob.data()), blob.size() };
-
-            std::istringstream stream{ std::string(view) };
+            std::ispanstream stream(std::span<const char>(reinterpret_cast<const char*>(blob.data()), blob.size()));
 
             boost::archive::text_iarchive archive(stream);
 
-            std::shared_ptr<T> incoming;
+            std::shared_ptr<Component> result;
 
-            archive >> incoming;
+            archive >> result;
 
-            if (!incoming)
-                return;
+            if (!result)
+                std::cerr << "Corrupt payload\n";
 
-            MergeSupport::MergeComponents(destination, incoming);
+            return result;
         }
 
+        std::unordered_map<EntityId, std::weak_ptr<GameObject>> entityCacheMap;
+
+        std::uint64_t currentTick = 0;
+
+#ifndef IS_SERVER
+        BaselineRing baselineRing;
+
+        struct TransformMirror
+        {
+            std::weak_ptr<Component> source;
+
+            std::shared_ptr<Transform3d> target;
+        };
+
+        std::unordered_map<const Component*, TransformMirror> transformMirrorMap;
+#endif
+
         static std::once_flag initializationFlag;
         static std::unique_ptr<ReceiverSynchronization> instance;
 
@@ -1,16 +1,29 @@
 #pragma once
 
+#include <array>
 #include <unordered_set>
 #include <queue>
+#include <limits>
+#include <list>
 #include <string_view>
 #include <boost/archive/text_oarchive.hpp>
+#include "Independent/ECS/Synchronization/BaselineRing.hpp"
 #include "Independent/ECS/Synchronization/CommonSynchronization.hpp"
+#include "Independent/ECS/Synchronization/SnapshotScheduler.hpp"
+#include "Independent/ECS/Synchronization/ComponentStateCodec.hpp"
+#include "Independent/ECS/Synchronization/DemoRecorder.hpp"
+#include "Independent/ECS/Synchronization/PeerEntityBindings.hpp"
 #include "Independent/ECS/Synchronization/SyncTracker.hpp"
 #include "Independent/ECS/IGameObjectSynchronization.hpp"
+#include "Independent/ECS/Prefab.hpp"
+#include "Independent/Network/WorldChunk.hpp"
 #include "Independent/Thread/MainThreadExecutor.hpp"
+#include "Independent/Thread/WorkerPool.hpp"
 
 #ifdef IS_SERVER
 #include "Server/Network/ServerNetwork.hpp" 
+#include "Server/Network/CongestionController.hpp"
+#include "Server/Network/InterestGrid.hpp"
 #else
 #include "Client/Network/ClientNetwork.hpp"
 #endif
@@ -28,6 +41,7 @@ namespace Blaster::Independent::ECS::Synchronization
     struct DirtyCompKey
     {
         std::weak_ptr<IGameObjectSynchronization> gameObject;
+        const IGameObjectSynchronization* identity;
         std::type_index componentType;
     };
 
@@ -35,9 +49,7 @@ namespace Blaster::Independent::ECS::Synchronization
     {
         std::size_t operator()(const DirtyCompKey& k) const noexcept
         {
-            auto sp = k.gameObject.lock();
-
-            std::size_t h1 = std::hash<void*>{}(sp.get());
+            std::size_t h1 = std::hash<const void*>{}(k.identity);
             std::size_t h2 = k.componentType.hash_code();
 
             return h1 ^ (h2 + 0x9e3779b9u + (h1 << 6) + (h1 >> 2));
@@ -48,10 +60,202 @@ namespace Blaster::Independent::ECS::Synchronization
     {
         bool operator()(const DirtyCompKey& a, const DirtyCompKey& b) const noexcept
         {
-            return a.componentType == b.componentType && a.gameObject.lock().get() == b.gameObject.lock().get();
+            return a.componentType == b.componentType && a.identity == b.identity;
+        }
+    };
+
+    struct DirtyEntry
+    {
+        std::shared_ptr<IGameObjectSynchronization> gameObject;
+        std::optional<std::type_index> component;
+
+        DirtyEntry* next{ nullptr };
+    };
+
+    struct alignas(64) DirtyJournal
+    {
+        DirtyJournal() = default;
+
+        DirtyJournal(const DirtyJournal&) = delete;
+        DirtyJournal(DirtyJournal&&) = delete;
+        DirtyJournal& operator=(const DirtyJournal&) = delete;
+        DirtyJournal& operator=(DirtyJournal&&) = delete;
+
+        ~DirtyJournal()
+        {
+            for (auto& head : entryHeadList)
+                FreeChain(head.exchange(nullptr));
+
+            FreeChain(freeHead.exchange(nullptr));
+            FreeChain(spare);
+        }
+
+        static void FreeChain(DirtyEntry* entry)
+        {
+            while (entry != nullptr)
+                delete std::exchange(entry, entry->next);
+        }
+
+        std::array<std::atomic<DirtyEntry*>, 2> entryHeadList{};
+
+        std::atomic<DirtyEntry*> freeHead{ nullptr };
+
+        DirtyEntry* spare{ nullptr };
+    };
+
+    struct PendingOperation
+    {
+        std::vector<std::uint8_t> bytes;
+
+        std::optional<std::string> coalesceKey;
+        std::uint64_t fieldMask{ 0 };
+
+        std::shared_ptr<const OpSetField> fullState;
+
+        std::string rootPath;
+
+        OpCode code{};
+        std::string path;
+
+        EntityId entityId{ 0 };
+        std::uint32_t referenceLength{ 0 };
+    };
+
+    struct ClientBacklog
+    {
+        std::list<PendingOperation> operationList;
+
+        std::unordered_map<std::string, std::list<PendingOperation>::iterator> coalesceMap;
+    };
+
+    struct TaggedOperation
+    {
+        std::uint32_t offset{ 0 };
+        std::uint32_t length{ 0 };
+        std::uint32_t rootIndex{ 0 };
+
+        std::optional<std::string> coalesceKey;
+        std::uint64_t fieldMask{ 0 };
+
+        std::shared_ptr<const OpSetField> fullState;
+
+        OpCode code{};
+        std::string path;
+
+        EntityId entityId{ 0 };
+        std::uint32_t referenceLength{ 0 };
+    };
+
+    struct RootTag
+    {
+        std::string path;
+
+        NetworkId owner{ 0 };
+    };
+
+    struct SnapshotTemplate
+    {
+        Snapshot snapshot{};
+
+        std::vector<TaggedOperation> operationList;
+        std::vector<RootTag> rootList;
+
+        std::unordered_map<std::string, std::uint32_t> rootIndexMap;
+
+        template <typename Op>
+        void Push(const Op& operation, const NetworkId owner)
+        {
+            std::vector<std::uint8_t> temporary;
+
+            DataConversion<Op>::Encode(operation, temporary);
+
+            TaggedOperation tag{ static_cast<std::uint32_t>(snapshot.operationBlob.size()), static_cast<std::uint32_t>(5 + temporary.size()), GetRootIndex(operation.path, owner) };
+
+            tag.code = Op::Code;
+            tag.path = operation.path;
+
+            if constexpr (std::is_same_v<Op, OpCreate> || std::is_same_v<Op, OpSpawn>)
+                tag.entityId = operation.entityId;
+#ifdef IS_SERVER
+            else if (operation.entityId == 0)
+            {
+                tag.entityId = NetworkEntityTable::GetInstance().FindId(operation.path).value_or(0);
+                tag.referenceLength = static_cast<std::uint32_t>(NetworkEntityTable::GetReferenceSize(0, operation.path));
+            }
+#endif
+
+            if constexpr (std::is_same_v<Op, OpSetField>)
+            {
+                tag.coalesceKey = BaselineRing::MakeKey(operation.path, operation.componentType);
+                tag.fieldMask = operation.fieldMask;
+
+                if (operation.fieldMask == 0)
+                    tag.fullState = std::make_shared<const OpSetField>(operation);
+            }
+
+            CommonNetwork::WriteTrivial(snapshot.operationBlob, static_cast<std::uint8_t>(Op::Code));
+            CommonNetwork::WriteTrivial(snapshot.operationBlob, static_cast<std::uint32_t>(temporary.size()));
+            CommonNetwork::WriteRaw(snapshot.operationBlob, temporary.data(), temporary.size());
+
+            ++snapshot.header.operationCount;
+
+            operationList.push_back(std::move(tag));
+        }
+
+        std::uint32_t GetRootIndex(const std::string& path, const NetworkId owner)
+        {
+            std::string root = path.substr(0, path.find('.'));
+
+            const auto [iterator, inserted] = rootIndexMap.try_emplace(root, static_cast<std::uint32_t>(rootList.size()));
+
+            if (inserted)
+                rootList.push_back({ std::move(root), owner });
+
+            return iterator->second;
         }
     };
 
+    struct JoinRoot
+    {
+        std::string path;
+        std::weak_ptr<IGameObjectSynchronization> node;
+
+        float distance{ 0.0f };
+    };
+
+    struct JoinStream
+    {
+        std::vector<JoinRoot> rootList;
+        std::size_t nextRoot{ 0 };
+
+        std::unordered_set<std::string> pendingSet;
+
+        std::size_t essentialRemaining{ 0 };
+        bool essentialSent{ false };
+        bool started{ false };
+
+        std::uint32_t nextChunk{ 0 };
+    };
+
+    struct ClientDrain
+    {
+        SnapshotTemplate interestTemplate;
+        std::vector<std::uint8_t> keepList;
+
+        bool due{ false };
+        bool useBaselines{ true };
+
+        std::size_t budget{ 0 };
+        std::uint64_t acked{ 0 };
+
+        Snapshot snapshot;
+
+        std::vector<std::pair<std::string, std::shared_ptr<const std::vector<std::uint8_t>>>> sentBaselineList;
+        std::vector<std::pair<std::string, EntityId>> bindingChangeList;
+
+        bool pending{ false };
+    };
+
     class SenderSynchronization final
     {
 
@@ -70,312 +274,1233 @@ namespace Blaster::Independent::ECS::Synchronization
                 return;
             }
 
-#ifndef IS_SERVER
-            auto sync = std::static_pointer_cast<IGameObjectSynchronization>(gameObject);
+#ifndef IS_SERVER
+            auto sync = std::static_pointer_cast<IGameObjectSynchronization>(gameObject);
+
+            if (sync->GetOwningClient().has_value() && sync->GetOwningClient().value() != Blaster::Client::Network::ClientNetwork::GetInstance().GetNetworkId())
+                return;
+#endif
+
+            auto synchronization = std::static_pointer_cast<IGameObjectSynchronization>(gameObject);
+
+            if (synchronization->IsLocal())
+                return;
+
+            const std::uint64_t epoch = dirtyEpoch.load(std::memory_order_seq_cst);
+
+            if (synchronization->GetDirtyEpoch().exchange(epoch, std::memory_order_acq_rel) == epoch)
+                return;
+
+            AppendDirty(epoch, std::move(synchronization), std::nullopt);
+
+            WakeFlusher();
+        }
+
+        void MarkDirty(const std::shared_ptr<GameObject>& gameObject, const std::type_index& component)
+        {
+            if (gSnapshotApplyDepth.load(std::memory_order_relaxed) != 0)
+            {
+                gDeferredDirty.push_back({ std::static_pointer_cast<IGameObjectSynchronization>(gameObject), component });
+
+                return;
+            }
+
+#ifndef IS_SERVER
+            auto sync = std::static_pointer_cast<IGameObjectSynchronization>(gameObject);
+
+            if (sync->GetOwningClient().has_value() && sync->GetOwningClient().value() != Blaster::Client::Network::ClientNetwork::GetInstance().GetNetworkId())
+                return;
+#endif
+
+            auto synchronization = std::static_pointer_cast<IGameObjectSynchronization>(gameObject);
+
+            if (synchronization->IsLocal())
+                return;
+
+            const std::uint64_t epoch = dirtyEpoch.load(std::memory_order_seq_cst);
+
+            const auto& componentMap = synchronization->GetComponentMap();
+
+            if (const auto iterator = componentMap.find(component); iterator != componentMap.end())
+            {
+                if (!iterator->second->ShouldSynchronize())
+                    return;
+
+                if (iterator->second->dirtyEpoch.exchange(epoch, std::memory_order_acq_rel) == epoch)
+                    return;
+            }
+
+            AppendDirty(epoch, std::move(synchronization), component);
+
+            WakeFlusher();
+        }
+
+        void UpdateOwner(const std::string& path, const std::optional<NetworkId> owner)
+        {
+            std::lock_guard guard(ownerMutex);
+
+            pendingOwnerMap[path] = owner.value_or(0);
+        }
+
+        void Tick()
+        {
+            if (SnapshotScheduler::GetInstance().ConsumeSnapshot())
+                FlushDirty();
+#ifdef IS_SERVER
+            else if (drainPending.load(std::memory_order_acquire) && SnapshotScheduler::GetInstance().ConsumeDrain())
+                DrainPending();
+#else
+            else if (SnapshotScheduler::GetInstance().ConsumeAck())
+                SendAck();
+#endif
+        }
+
+        void FlushDirty()
+        {
+            if (!flushRequested.exchange(false, std::memory_order_acq_rel))
+                return;
+
+            SnapshotTemplate snapshotTemplate{};
+
+            Snapshot& templateSnapshot = snapshotTemplate.snapshot;
+
+            templateSnapshot.header.operationCount = 0;
+            templateSnapshot.header.tick = SnapshotScheduler::GetInstance().GetStampTick();
+
+#ifdef IS_SERVER
+            templateSnapshot.header.route = Route::ServerBroadcast;
+            templateSnapshot.header.origin = 0;
+#else
+            templateSnapshot.header.route = Route::RelayOnce;
+            templateSnapshot.header.origin = Blaster::Client::Network::ClientNetwork::GetInstance().GetNetworkId();
+#endif
+
+            std::vector<std::string> destroyedPathList;
+
+            std::unordered_set<std::shared_ptr<IGameObjectSynchronization>> gameObjectSet;
+            std::unordered_set<DirtyCompKey, DirtyCompHash, DirtyCompEqual> componentSet;
+            std::unordered_map<std::string, NetworkId> ownerChangeMap;
+
+            DrainJournals(gameObjectSet, componentSet);
+
+            {
+                std::lock_guard guard(ownerMutex);
+
+                ownerChangeMap.swap(pendingOwnerMap);
+            }
+
+            for (const auto& [path, owner] : ownerChangeMap)
+            {
+                if (const auto hit = ownerCacheMap.find(path); hit != ownerCacheMap.end())
+                    hit->second = owner;
+            }
+
+            for (auto const& node : gameObjectSet)
+            {
+                if (node->IsDestroyed())
+                {
+                    ownerCacheMap.erase(node->GetAbsolutePath());
+                    destroyedPathList.push_back(node->GetAbsolutePath());
+
+                    for (const auto& component : node->GetComponentMap() | std::views::values)
+                        ForgetHash(component);
+
+#ifdef IS_SERVER
+                    for (auto& ring : baselineMap | std::views::values)
+                        ring.ForgetPath(node->GetAbsolutePath());
+
+                    ForgetInterest(node->GetAbsolutePath());
+#endif
+
+                    PushTemplateOp(snapshotTemplate, OpDestroy{ node->GetAbsolutePath() });
+
+                    continue;
+                }
+
+                if (node->WasJustCreated() && node->IsPrefabMember())
+                    continue;
+
+                if (node->WasJustCreated())
+                {
+                    ownerCacheMap[node->GetAbsolutePath()] = node->GetOwningClient().value_or(0);
+
+                    if (const auto prefab = FindPrefab(node))
+                    {
+                        PushSpawn(node, *prefab, [&](const auto& operation) { PushTemplateOp(snapshotTemplate, operation); }, true);
+
+                        node->ClearJustCreated();
+
+                        continue;
+                    }
+
+                    PushTemplateOp(snapshotTemplate, OpCreate{ node->GetAbsolutePath(), node->GetTypeName(), node->GetOwningClient(), ResolveEntityId(node->GetAbsolutePath()) });
+
+                    for (auto& component : node->GetComponentMap() | std::views::values)
+                    {
+                        if (!component->ShouldSynchronize())
+                            continue;
+
+                        PushTemplateOp(snapshotTemplate, OpAddComponent{ node->GetAbsolutePath(), static_cast<int>(Utility::TypeRegistrar::GetIdFromRuntimeName(component->GetTypeName()).value()), CommonNetwork::SerializePointerToBlob(component) });
+
+                        component->ClearWasAdded();
+
+                        RememberHash(component);
+                    }
+
+                    node->ClearJustCreated();
+                }
+            }
+
+            for (const auto& [gameObject, identity, componentType] : componentSet)
+            {
+                const auto gameObjectPointer = gameObject.lock();
+
+                if (!gameObjectPointer)
+                    continue;
+
+                const auto componentIterator = gameObjectPointer->GetComponentMap().find(componentType);
+
+                if (componentIterator == gameObjectPointer->GetComponentMap().end())
+                {
+                    const int componentTypeId = static_cast<int>(Utility::TypeRegistrar::GetIdFromRuntimeName(componentType.name()).value());
+
+                    PushTemplateOp(snapshotTemplate, OpRemoveComponent{ gameObjectPointer->GetAbsolutePath(), componentTypeId });
+
+#ifdef IS_SERVER
+                    for (auto& ring : baselineMap | std::views::values)
+                        ring.Forget(BaselineRing::MakeKey(gameObjectPointer->GetAbsolutePath(), componentTypeId));
+#endif
+
+                    ForgetHash(componentIterator->second);
+
+                    continue;
+                }
+
+                if (const auto& component = componentIterator->second; component->WasAdded())
+                {
+                    if (!component->ShouldSynchronize())
+                        continue;
+
+                    if (HasStateChanged(component))
+                    {
+                        PushTemplateOp(snapshotTemplate, OpAddComponent{ gameObjectPointer->GetAbsolutePath(), static_cast<int>(Utility::TypeRegistrar::GetIdFromRuntimeName(component->GetTypeName()).value()), CommonNetwork::SerializePointerToBlob(component) });
+                        component->ClearWasAdded();
+                    }
+                }
+                else
+                {
+                    if (!component->ShouldSynchronize())
+                        continue;
+
+                    std::uint64_t fieldMask = 0;
+
+                    if (HasStateChanged(component, fieldMask))
+                    {
+                        const int componentTypeId = static_cast<int>(Utility::TypeRegistrar::GetIdFromRuntimeName(component->GetTypeName()).value());
+
+                        std::optional<std::vector<std::uint8_t>> fieldBlob = fieldMask != 0 ? MergeSupport::EncodeFields(component, fieldMask) : std::nullopt;
+
+                        if (fieldBlob.has_value())
+                            PushTemplateOp(snapshotTemplate, OpSetField{ gameObjectPointer->GetAbsolutePath(), componentTypeId, fieldMask, std::move(fieldBlob.value()) });
+                        else
+                            PushTemplateOp(snapshotTemplate, OpSetField{ gameObjectPointer->GetAbsolutePath(), componentTypeId, 0, ComponentStateCodec::Encode(componentTypeId, *component) });
+                    }
+                }
+            }
+
+#ifdef IS_SERVER
+            if (DemoRecorder::GetInstance().IsRecording())
+                DemoRecorder::GetInstance().RecordDelta(templateSnapshot);
+
+            drainPending.store(false, std::memory_order_release);
+
+            if (BuildClientSnapshots(GetSessionClients(), snapshotTemplate))
+                ScheduleDrain();
+#else
+            if (templateSnapshot.header.operationCount == 0)
+                return;
+
+            {
+                constexpr NetworkId ServerId = 0;
+
+                Snapshot snapshot = templateSnapshot;
+
+                snapshot.header.sequence = SyncTracker::GetInstance().AllocateSequence(ServerId);
+                snapshot.header.ack = SyncTracker::GetInstance().GetLastIncoming(ServerId);
+
+                Blaster::Client::Network::ClientNetwork::GetInstance().Send(PacketType::C2S_Snapshot, snapshot);
+
+                lastAckSent = snapshot.header.ack;
+
+                std::cout << "Sent snapshot to server with seqence '" << snapshot.header.sequence << "' and ack '" << snapshot.header.ack << "' ('" << snapshot.header.operationCount << "' operations)!" << std::endl;
+            }
+#endif
+
+            for (const std::string& path : destroyedPathList)
+                NetworkEntityTable::GetInstance().ForgetPath(path);
+             
+            for (auto iterator = lastHashMap.begin(); iterator != lastHashMap.end(); )
+            {
+                if (iterator->first == nullptr)
+                {
+                    std::cerr << "Items in the lastHashMap variable in SenderSynchronization had null keys. This shouldn't happen!" << std::endl;
+                    iterator = lastHashMap.erase(iterator);
+                }
+                else
+                    ++iterator;
+            }
+        }
+
+        Snapshot BuildFullSnapshot(const std::vector<std::shared_ptr<GameObject>>& gameObjectList)
+        {
+            SnapshotTemplate snapshotTemplate{};
+
+            snapshotTemplate.snapshot.header.route = Route::ServerBroadcast;
+            snapshotTemplate.snapshot.header.tick = SnapshotScheduler::GetInstance().GetTick();
+
+            for (const auto& root : gameObjectList)
+            {
+                const auto node = std::static_pointer_cast<IGameObjectSynchronization>(root);
+
+                if (node->IsLocal() || node->IsDestroyed())
+                    continue;
+
+                SerializeSubTree(node, snapshotTemplate);
+            }
+
+            return std::move(snapshotTemplate.snapshot);
+        }
+
+        void SynchronizeFullTree(const NetworkId targetClient, const std::vector<std::shared_ptr<GameObject>>& gameObjectList)
+        {
+#ifdef IS_SERVER
+            Blaster::Server::Network::InterestGrid::GetInstance().ResetClient(targetClient);
+            Blaster::Server::Network::InterestGrid::GetInstance().Refresh(targetClient);
+
+            JoinStream stream{};
+
+            for (const auto& root : gameObjectList)
+            {
+                const auto node = std::static_pointer_cast<IGameObjectSynchronization>(root);
+                const std::string path = node->GetAbsolutePath();
+
+                if (!Blaster::Server::Network::InterestGrid::GetInstance().IsInterested(targetClient, path))
+                    continue;
+
+                const float distance = Blaster::Server::Network::InterestGrid::GetInstance().GetDistance(targetClient, path).value_or(std::numeric_limits<float>::max());
+
+                if (distance <= kEssentialRadius)
+                    ++stream.essentialRemaining;
+
+                stream.pendingSet.insert(path);
+                stream.rootList.push_back({ path, node, distance });
+            }
+
+            std::ranges::stable_sort(stream.rootList, {}, &JoinRoot::distance);
+
+            std::unique_lock guard(joinMutex);
+
+            joinStreamMap[targetClient] = std::move(stream);
+#else
+            Snapshot snapshot;
+
+            snapshot.header.operationCount = 0;
+            snapshot.header.sequence = SyncTracker::GetInstance().AllocateSequence(targetClient);
+            snapshot.header.ack = SyncTracker::GetInstance().GetLastIncoming(targetClient);
+            snapshot.header.route = Route::RelayOnce;
+            snapshot.header.origin = Blaster::Client::Network::ClientNetwork::GetInstance().GetNetworkId();
+            snapshot.header.tick = SnapshotScheduler::GetInstance().GetStampTick();
+
+            SnapshotTemplate snapshotTemplate{};
+
+            for (const auto& root : gameObjectList)
+                SerializeSubTree(std::static_pointer_cast<IGameObjectSynchronization>(root), snapshotTemplate);
+
+            snapshot.operationBlob = std::move(snapshotTemplate.snapshot.operationBlob);
+            snapshot.header.operationCount = snapshotTemplate.snapshot.header.operationCount;
+
+            Blaster::Client::Network::ClientNetwork::GetInstance().Send(PacketType::C2S_Snapshot, snapshot);
+#endif
+        }
+
+#ifndef IS_SERVER
+        void SendAck()
+        {
+            constexpr NetworkId ServerId = 0;
+
+            const std::uint64_t incoming = SyncTracker::GetInstance().GetLastIncoming(ServerId);
+
+            if (incoming <= lastAckSent)
+                return;
+
+            Snapshot snapshot;
+
+            snapshot.header.operationCount = 0;
+            snapshot.header.sequence = SyncTracker::GetInstance().AllocateSequence(ServerId);
+            snapshot.header.ack = incoming;
+            snapshot.header.route = Route::ToServerOnly;
+            snapshot.header.origin = Blaster::Client::Network::ClientNetwork::GetInstance().GetNetworkId();
+            snapshot.header.tick = SnapshotScheduler::GetInstance().GetStampTick();
+
+            Blaster::Client::Network::ClientNetwork::GetInstance().Send(PacketType::C2S_Snapshot, snapshot);
+
+            lastAckSent = incoming;
+        }
+#endif
+
+#ifdef IS_SERVER
+        void PumpJoinStreams()
+        {
+            std::unique_lock guard(joinMutex);
+
+            std::size_t budget = kJoinBytesPerTick;
+
+            while (budget > 0 && !joinStreamMap.empty())
+            {
+                for (auto iterator = joinStreamMap.begin(); iterator != joinStreamMap.end() && budget > 0; )
+                {
+                    budget -= std::min(budget, SendJoinChunk(iterator->first, iterator->second, std::min(budget, kJoinChunkBytes)));
+
+                    if (iterator->second.nextRoot < iterator->second.rootList.size())
+                        ++iterator;
+                    else
+                        iterator = joinStreamMap.erase(iterator);
+                }
+            }
+        }
+
+        void ResumeClient(const NetworkId targetClient, const std::uint64_t lastSequence, const std::vector<std::shared_ptr<GameObject>>& gameObjectList)
+        {
+            const auto missed = SyncTracker::GetInstance().CollectSince(targetClient, lastSequence);
+
+            if (!missed.has_value())
+            {
+                std::cout << "History for client '" << targetClient << "' does not cover sequence '" << lastSequence << "'; sending full tree." << std::endl;
+
+                SynchronizeFullTree(targetClient, gameObjectList);
+
+                return;
+            }
+
+            for (const Snapshot& snapshot : missed.value())
+                Blaster::Server::Network::ServerNetwork::GetInstance().SendTo(targetClient, PacketType::S2C_Snapshot, snapshot);
+
+            std::cout << "Resent '" << missed->size() << "' snapshot(s) to client '" << targetClient << "' since sequence '" << lastSequence << "'." << std::endl;
+        }
+
+        bool BuildClientSnapshots(const std::vector<NetworkId>& clientList, const SnapshotTemplate& snapshotTemplate, const bool parallel = true)
+        {
+            std::vector<ClientDrain> drainList(clientList.size());
+
+            const auto now = SnapshotScheduler::Clock::now();
+
+            const auto clientHandleList = Blaster::Server::Network::ServerNetwork::GetInstance().GetClientHandles(clientList);
+
+            const std::uint64_t tick = SnapshotScheduler::GetInstance().GetTick();
+            const float elapsedTicks = static_cast<float>(tick - std::min(priorityTick, tick));
+
+            priorityTick = tick;
+
+            for (std::size_t i = 0; i < clientList.size(); ++i)
+            {
+                const NetworkId id = clientList[i];
+
+                ClientDrain& drain = drainList[i];
+
+                backlogMap.try_emplace(id);
+                baselineMap.try_emplace(id);
+                bindingMap.try_emplace(id);
+
+                auto& priorityMap = clientPriorityMap[id];
+
+                const Blaster::Server::Network::InterestChange change = Blaster::Server::Network::InterestGrid::GetInstance().Refresh(id);
+
+                for (const std::string& path : change.leftList)
+                    priorityMap.erase(path);
+
+                if (elapsedTicks > 0.0f)
+                {
+                    for (auto& [rootPath, priority] : priorityMap)
+                        priority += GetPriorityWeight(id, rootPath) * elapsedTicks;
+                }
+
+                {
+                    std::shared_lock joinGuard(joinMutex);
+
+                    const auto stream = joinStreamMap.find(id);
+                    const std::unordered_set<std::string>* pendingSet = stream == joinStreamMap.end() ? nullptr : &stream->second.pendingSet;
+
+                    BuildInterestChange(id, change, drain.interestTemplate, pendingSet);
+
+                    if (!snapshotTemplate.operationList.empty())
+                    {
+                        drain.keepList.assign(snapshotTemplate.rootList.size(), 0);
+
+                        for (std::size_t root = 0; root < drain.keepList.size(); ++root)
+                        {
+                            const RootTag& tag = snapshotTemplate.rootList[root];
+
+                            drain.keepList[root] = tag.owner != id && Blaster::Server::Network::InterestGrid::GetInstance().IsInterested(id, tag.path) && std::ranges::find(change.enteredList, tag.path) == change.enteredList.end() && (pendingSet == nullptr || !pendingSet->contains(tag.path));
+                        }
+                    }
+                }
+
+                drain.due = SnapshotScheduler::GetInstance().ConsumeClient(id, now);
+
+                if (!drain.due)
+                    continue;
+
+                drain.budget = Blaster::Server::Network::CongestionController::GetInstance().BeginTick(id);
+                drain.acked = SyncTracker::GetInstance().GetLastAcked(id);
+                drain.useBaselines = !(clientHandleList[i] && clientHandleList[i]->relay);
+
+                drain.snapshot.header = snapshotTemplate.snapshot.header;
+                drain.snapshot.header.operationCount = 0;
+            }
+
+            const auto buildClient = [&](const std::size_t index)
+                {
+                    const NetworkId id = clientList[index];
+
+                    ClientDrain& drain = drainList[index];
+                    ClientBacklog& backlog = backlogMap.at(id);
+
+                    AppendToBacklog(backlog, drain.interestTemplate, nullptr);
+
+                    if (!drain.keepList.empty())
+                        AppendToBacklog(backlog, snapshotTemplate, &drain.keepList);
+
+                    if (drain.due)
+                        DrainBacklog(backlog, clientPriorityMap.at(id), baselineMap.at(id), bindingMap.at(id), drain);
+
+                    drain.pending = !backlog.operationList.empty();
+                };
+
+            if (parallel)
+                WorkerPool::GetInstance().ParallelFor(clientList.size(), buildClient);
+            else
+            {
+                for (std::size_t i = 0; i < clientList.size(); ++i)
+                    buildClient(i);
+            }
+
+            for (std::size_t i = 0; i < clientList.size(); ++i)
+            {
+                ClientDrain& drain = drainList[i];
+
+                if (drain.snapshot.header.operationCount != 0)
+                    SendDrained(clientList[i], clientHandleList[i], drain);
+            }
+
+            return std::ranges::any_of(drainList, [](const ClientDrain& drain) { return drain.pending; });
+        }
+
+        void TrackInterest(const std::shared_ptr<GameObject>& root, const Vector<float, 3>& position)
+        {
+            const auto node = std::static_pointer_cast<IGameObjectSynchronization>(root);
+
+            if (node->IsLocal() || node->IsDestroyed())
+                return;
+
+            const std::string path = node->GetAbsolutePath();
+
+            {
+                std::lock_guard guard(interestMutex);
+                interestRootMap[path] = node;
+            }
+
+            Blaster::Server::Network::InterestGrid::GetInstance().Update(path, position);
+        }
+
+        void SetInterestFocus(const NetworkId id, const std::shared_ptr<GameObject>& root, const Vector<float, 3>& position)
+        {
+            TrackInterest(root, position);
+
+            Blaster::Server::Network::InterestGrid::GetInstance().SetFocus(id, std::static_pointer_cast<IGameObjectSynchronization>(root)->GetAbsolutePath());
+        }
+
+        void ResendFullState(const NetworkId id, const std::shared_ptr<IGameObjectSynchronization>& node, const int componentType)
+        {
+            const auto backlog = backlogMap.find(id);
+
+            if (backlog == backlogMap.end() || node->IsDestroyed())
+                return;
+
+            const std::string path = node->GetAbsolutePath();
+            const std::string typeName = Utility::TypeRegistrar::GetRuntimeName(componentType);
+
+            const auto& componentOrder = node->GetComponentOrder();
+            const auto component = std::ranges::find_if(componentOrder, [&typeName](const auto& candidate) { return candidate->GetTypeName() == typeName; });
+
+            if (component == componentOrder.end() || !(*component)->ShouldSynchronize())
+                return;
+
+            baselineMap.at(id).Forget(BaselineRing::MakeKey(path, componentType));
+
+            SnapshotTemplate snapshotTemplate{};
+
+            PushTemplateOp(snapshotTemplate, OpSetField{ path, componentType, 0, ComponentStateCodec::Encode(componentType, **component) });
+
+            AppendToBacklog(backlog->second, snapshotTemplate, nullptr);
+
+            std::cout << "Client '" << id << "' is missing a baseline for '" << BaselineRing::MakeKey(path, componentType) << "'; queued full state." << std::endl;
+        }
+
+        Snapshot SerializeHandoff(const std::shared_ptr<IGameObjectSynchronization>& root)
+        {
+            SnapshotTemplate snapshotTemplate{};
+
+            SerializeSubTree(root, snapshotTemplate);
+
+            return std::move(snapshotTemplate.snapshot);
+        }
+
+        void ForgetClient(const NetworkId id)
+        {
+            backlogMap.erase(id);
+            baselineMap.erase(id);
+            bindingMap.erase(id);
+            clientPriorityMap.erase(id);
+
+            {
+                std::unique_lock guard(joinMutex);
+                joinStreamMap.erase(id);
+            }
+
+            Blaster::Server::Network::InterestGrid::GetInstance().ForgetClient(id);
+
+            Blaster::Server::Network::CongestionController::GetInstance().ForgetClient(id);
+
+            SnapshotScheduler::GetInstance().ForgetClient(id);
+        }
+
+        static std::vector<NetworkId> GetSessionClients()
+        {
+            std::vector<NetworkId> result = Blaster::Server::Network::ServerNetwork::GetInstance().GetConnectedClients();
+            const std::vector<NetworkId> parked = Blaster::Server::Network::ServerNetwork::GetInstance().GetParkedClients();
+
+            result.insert(result.end(), parked.begin(), parked.end());
+
+            return result;
+        }
+#endif
+
+        void RememberHash(const std::shared_ptr<Component>& comp)
+        {
+            if (MergeSupport::DiffFields(comp, fieldShadowMap[comp.get()]).has_value())
+                return;
+
+            const uint64_t handle = ComponentStateHash(comp);
+
+            lastHashMap[comp.get()] = handle;
+        }
+
+        void ForgetHash(const std::shared_ptr<Component>& comp)
+        {
+            lastHashMap.erase(comp.get());
+            fieldShadowMap.erase(comp.get());
+        }
+
+        static SenderSynchronization& GetInstance()
+        {
+            std::call_once(initializationFlag, [&]()
+            {
+                instance = std::unique_ptr<SenderSynchronization>(new SenderSynchronization());
+            });
+
+            return *instance;
+        }
+
+    private:
+
+        SenderSynchronization() = default;
+
+        void WakeFlusher()
+        {
+            if (!flushRequested.load(std::memory_order_seq_cst))
+                flushRequested.store(true, std::memory_order_seq_cst);
+        }
+
+        DirtyJournal& GetLocalJournal()
+        {
+            thread_local DirtyJournal* journal = nullptr;
+
+            if (journal == nullptr)
+            {
+                std::lock_guard guard(journalMutex);
+
+                journal = journalList.emplace_back(std::make_unique<DirtyJournal>()).get();
+            }
+
+            return *journal;
+        }
+
+        void AppendDirty(const std::uint64_t epoch, std::shared_ptr<IGameObjectSynchronization> gameObject, const std::optional<std::type_index>& component)
+        {
+            DirtyJournal& journal = GetLocalJournal();
+
+            if (journal.spare == nullptr)
+                journal.spare = journal.freeHead.exchange(nullptr, std::memory_order_acquire);
+
+            DirtyEntry* entry = journal.spare;
+
+            if (entry != nullptr)
+                journal.spare = entry->next;
+            else
+                entry = new DirtyEntry();
+
+            entry->gameObject = std::move(gameObject);
+            entry->component = component;
+
+            auto& head = journal.entryHeadList[epoch & 1];
+
+            entry->next = head.load(std::memory_order_relaxed);
+
+            while (!head.compare_exchange_weak(entry->next, entry, std::memory_order_release, std::memory_order_relaxed)) { }
+        }
+
+        void DrainJournals(std::unordered_set<std::shared_ptr<IGameObjectSynchronization>>& gameObjectSet, std::unordered_set<DirtyCompKey, DirtyCompHash, DirtyCompEqual>& componentSet)
+        {
+            const std::uint64_t epoch = dirtyEpoch.fetch_add(1, std::memory_order_seq_cst);
+
+            std::lock_guard guard(journalMutex);
+
+            for (const auto& journal : journalList)
+            {
+                DrainChain(*journal, epoch & 1, false, gameObjectSet, componentSet);
+                DrainChain(*journal, (epoch + 1) & 1, true, gameObjectSet, componentSet);
+            }
+        }
+
+        void DrainChain(DirtyJournal& journal, const std::size_t index, const bool currentEpoch, std::unordered_set<std::shared_ptr<IGameObjectSynchronization>>& gameObjectSet, std::unordered_set<DirtyCompKey, DirtyCompHash, DirtyCompEqual>& componentSet)
+        {
+            DirtyEntry* chain = journal.entryHeadList[index].exchange(nullptr, std::memory_order_acquire);
+
+            if (chain == nullptr)
+                return;
+
+            DirtyEntry* tail = chain;
+
+            for (DirtyEntry* entry = chain; entry != nullptr; entry = entry->next)
+            {
+                const IGameObjectSynchronization* identity = entry->gameObject.get();
+
+                if (currentEpoch)
+                    ClearMark(*entry);
+
+                if (entry->component.has_value())
+                    componentSet.emplace(DirtyCompKey{ entry->gameObject, identity, entry->component.value() });
+                else
+                    gameObjectSet.insert(entry->gameObject);
+
+                entry->gameObject.reset();
+                entry->component.reset();
+
+                tail = entry;
+            }
+
+            tail->next = journal.freeHead.load(std::memory_order_relaxed);
+
+            while (!journal.freeHead.compare_exchange_weak(tail->next, chain, std::memory_order_release, std::memory_order_relaxed)) { }
+        }
+
+        static void ClearMark(const DirtyEntry& entry)
+        {
+            if (!entry.component.has_value())
+            {
+                entry.gameObject->GetDirtyEpoch().store(0, std::memory_order_release);
+                return;
+            }
+
+            const auto& componentMap = entry.gameObject->GetComponentMap();
+
+            if (const auto iterator = componentMap.find(entry.component.value()); iterator != componentMap.end())
+                iterator->second->dirtyEpoch.store(0, std::memory_order_release);
+        }
+
+#ifdef IS_SERVER
+        void AppendToBacklog(ClientBacklog& backlog, const SnapshotTemplate& source, const std::vector<std::uint8_t>* keepList)
+        {
+            const std::vector<std::uint8_t>& blob = source.snapshot.operationBlob;
+
+            for (const TaggedOperation& tag : source.operationList)
+            {
+                if (keepList != nullptr && (*keepList)[tag.rootIndex] == 0)
+                    continue;
+
+                PendingOperation operation{ { blob.begin() + tag.offset, blob.begin() + tag.offset + tag.length }, tag.coalesceKey };
+
+                operation.rootPath = source.rootList[tag.rootIndex].path;
+                operation.fieldMask = tag.fieldMask;
+                operation.fullState = tag.fullState;
+                operation.code = tag.code;
+                operation.path = tag.path;
+                operation.entityId = tag.entityId;
+                operation.referenceLength = tag.referenceLength;
+
+                if (operation.coalesceKey.has_value())
+                {
+                    if (const auto previous = backlog.coalesceMap.find(operation.coalesceKey.value()); previous != backlog.coalesceMap.end())
+                    {
+                        const std::uint64_t previousMask = previous->second->fieldMask;
+
+                        if (operation.fieldMask == 0 || (previousMask != 0 && (previousMask & ~operation.fieldMask) == 0))
+                            backlog.operationList.erase(previous->second);
+                    }
+                }
+
+                backlog.operationList.push_back(std::move(operation));
+
+                if (backlog.operationList.back().coalesceKey.has_value())
+                    backlog.coalesceMap[backlog.operationList.back().coalesceKey.value()] = std::prev(backlog.operationList.end());
+            }
+        }
+
+        void DrainBacklog(ClientBacklog& backlog, std::unordered_map<std::string, float>& priorityMap, const BaselineRing& ring, const PeerEntityBindings& bindings, ClientDrain& drain)
+        {
+            if (backlog.operationList.empty())
+                return;
+
+            Snapshot& snapshot = drain.snapshot;
+
+            auto trySend = [&](const std::list<PendingOperation>::iterator operation)
+                {
+                    const EntityId boundId = operation->referenceLength != 0 && IsBound(bindings, drain, *operation) ? operation->entityId : 0;
+
+                    std::shared_ptr<const std::vector<std::uint8_t>> fullBlob;
+                    std::optional<std::vector<std::uint8_t>> delta;
+
+                    if (drain.useBaselines)
+                        delta = EncodeAgainstBaseline(ring, *operation, drain.acked, boundId, fullBlob);
+
+                    if (!delta.has_value() && boundId != 0)
+                        delta = CompactReference(*operation);
+
+                    const std::vector<std::uint8_t>& bytes = delta.has_value() ? delta.value() : operation->bytes;
+
+                    if (snapshot.header.operationCount != 0 && snapshot.operationBlob.size() + bytes.size() > drain.budget)
+                        return false;
+
+                    if (snapshot.header.operationCount == 0 && bytes.size() > drain.budget && drain.budget < kMinimumDrainBytes)
+                        return false;
+
+                    snapshot.operationBlob.insert(snapshot.operationBlob.end(), bytes.begin(), bytes.end());
+                    ++snapshot.header.operationCount;
+
+                    if (fullBlob)
+                        drain.sentBaselineList.emplace_back(operation->coalesceKey.value(), std::move(fullBlob));
+
+                    if ((operation->code == OpCode::Create || operation->code == OpCode::Spawn) && operation->entityId != 0)
+                        drain.bindingChangeList.emplace_back(operation->path, operation->entityId);
+                    else if (operation->code == OpCode::Destroy)
+                        drain.bindingChangeList.emplace_back(operation->path, 0);
+
+                    if (operation->coalesceKey.has_value())
+                    {
+                        if (const auto latest = backlog.coalesceMap.find(operation->coalesceKey.value()); latest != backlog.coalesceMap.end() && latest->second == operation)
+                            backlog.coalesceMap.erase(latest);
+                    }
+
+                    backlog.operationList.erase(operation);
 
-            if (sync->GetOwningClient().has_value() && sync->GetOwningClient().value() != Blaster::Client::Network::ClientNetwork::GetInstance().GetNetworkId())
-                return;
-#endif
+                    return true;
+                };
 
-            if (std::static_pointer_cast<IGameObjectSynchronization>(gameObject)->IsLocal())
-                return;
+            std::vector<std::string> rootOrder;
+            std::unordered_map<std::string, std::vector<std::list<PendingOperation>::iterator>> rootOperationMap;
 
+            for (auto iterator = backlog.operationList.begin(); iterator != backlog.operationList.end(); ++iterator)
             {
-                std::unique_lock guard(dirtyMutex);
-                dirtyGameObjectSet.insert(std::static_pointer_cast<IGameObjectSynchronization>(gameObject));
+                auto& operationList = rootOperationMap[iterator->rootPath];
+
+                if (operationList.empty())
+                    rootOrder.push_back(iterator->rootPath);
+
+                operationList.push_back(iterator);
             }
 
-            WakeFlusher();
-        }
+            for (const std::string& rootPath : rootOrder)
+                priorityMap.try_emplace(rootPath, 0.0f);
 
-        void MarkDirty(const std::shared_ptr<GameObject>& gameObject, const std::type_index& component)
-        {
-            if (gSnapshotApplyDepth.load(std::memory_order_relaxed) != 0)
+            std::ranges::stable_sort(rootOrder, std::greater{}, [&priorityMap](const std::string& rootPath) { return priorityMap.at(rootPath); });
+
+            for (const std::string& rootPath : rootOrder)
             {
-                gDeferredDirty.push_back({ std::static_pointer_cast<IGameObjectSynchronization>(gameObject), component });
+                bool sent = false;
 
-                return;
+                for (const auto operation : rootOperationMap.at(rootPath))
+                {
+                    if (!trySend(operation))
+                        break;
+
+                    sent = true;
+                }
+
+                if (sent)
+                    priorityMap.erase(rootPath);
             }
+        }
 
-#ifndef IS_SERVER
-            auto sync = std::static_pointer_cast<IGameObjectSynchronization>(gameObject);
+        void SendDrained(const NetworkId id, const std::shared_ptr<Blaster::Server::Network::ServerNetwork::ClientReference>& client, ClientDrain& drain)
+        {
+            Snapshot& snapshot = drain.snapshot;
 
-            if (sync->GetOwningClient().has_value() && sync->GetOwningClient().value() != Blaster::Client::Network::ClientNetwork::GetInstance().GetNetworkId())
-                return;
-#endif
+            snapshot.header.sequence = SyncTracker::GetInstance().AllocateSequence(id);
+            snapshot.header.ack = SyncTracker::GetInstance().GetLastIncoming(id);
 
-            if (std::static_pointer_cast<IGameObjectSynchronization>(gameObject)->IsLocal() || (std::static_pointer_cast<IGameObjectSynchronization>(gameObject)->GetComponentMap().contains(component) && !std::static_pointer_cast<IGameObjectSynchronization>(gameObject)->GetComponentMap().at(component)->ShouldSynchronize()))
-                return;
+            for (auto& [key, blob] : drain.sentBaselineList)
+                baselineMap.at(id).Record(key, snapshot.header.sequence, std::move(blob));
 
+            PeerEntityBindings& bindings = bindingMap.at(id);
+
+            for (const auto& [path, entityId] : drain.bindingChangeList)
             {
-                std::unique_lock guard(dirtyMutex);
-                dirtyComponentSet.emplace(DirtyCompKey{ std::static_pointer_cast<IGameObjectSynchronization>(gameObject), component });
+                if (entityId == 0)
+                    bindings.ForgetPath(path);
+                else
+                    bindings.Record(path, entityId, snapshot.header.sequence);
             }
 
-            WakeFlusher();
+            Blaster::Server::Network::ServerNetwork::GetInstance().SendTo(client, PacketType::S2C_Snapshot, snapshot);
+            SyncTracker::GetInstance().RecordOutgoing(id, snapshot);
+            Blaster::Server::Network::CongestionController::GetInstance().OnSent(id, snapshot.header.sequence);
+
+            std::cout << "Sent snapshot to client '" << id << "' with seqence '" << snapshot.header.sequence << "' and ack '" << snapshot.header.ack << "' ('" << snapshot.header.operationCount << "' operations, '" << backlogMap.at(id).operationList.size() << "' deferred)!" << std::endl;
         }
 
-        void FlushDirty()
+        float GetPriorityWeight(const NetworkId id, const std::string& rootPath) const
         {
-            if (!flushRequested.exchange(false, std::memory_order_acq_rel))
-                return;
+            const auto owner = ownerCacheMap.find(rootPath);
 
-            Snapshot templateSnapshot{};
+            float weight = owner != ownerCacheMap.end() && owner->second != 0 ? kPlayerPriority : kPropPriority;
 
-            templateSnapshot.header.operationCount = 0;
+            if (const auto distance = Blaster::Server::Network::InterestGrid::GetInstance().GetDistance(id, rootPath); distance.has_value())
+                weight *= kPriorityFalloff / (kPriorityFalloff + distance.value());
 
-#ifdef IS_SERVER
-            templateSnapshot.header.route = Route::ServerBroadcast;
-            templateSnapshot.header.origin = 0;
-#else
-            templateSnapshot.header.route = Route::RelayOnce;
-            templateSnapshot.header.origin = Blaster::Client::Network::ClientNetwork::GetInstance().GetNetworkId();
-#endif
+            return weight;
+        }
 
-            {
-                std::unique_lock guard(dirtyMutex);
+        static bool IsBound(const PeerEntityBindings& bindings, const ClientDrain& drain, const PendingOperation& operation)
+        {
+            if (!bindings.IsBound(operation.path, operation.entityId, drain.acked))
+                return false;
 
-                for (auto const& node : dirtyGameObjectSet)
+            return std::ranges::none_of(drain.bindingChangeList, [&operation](const auto& change)
                 {
-                    if (node->IsDestroyed())
-                    {
-                        ownerCacheMap.erase(node->GetAbsolutePath());
+                    return change.second == 0 && (operation.path == change.first || operation.path.starts_with(change.first + "."));
+                });
+        }
 
-                        for (const auto& component : node->GetComponentMap() | std::views::values)
-                            ForgetHash(component);
+        static std::vector<std::uint8_t> CompactReference(const PendingOperation& operation)
+        {
+            const std::size_t tail = 5 + operation.referenceLength;
 
-                        PushOp(templateSnapshot.operationBlob, OpDestroy{ node->GetAbsolutePath() });
+            std::vector<std::uint8_t> result;
 
-                        ++templateSnapshot.header.operationCount;
+            result.reserve(operation.bytes.size() - tail + 5 + sizeof(EntityId));
 
-                        continue;
-                    }
+            CommonNetwork::WriteTrivial(result, operation.bytes[0]);
+            CommonNetwork::WriteTrivial(result, static_cast<std::uint32_t>(operation.bytes.size() - tail + sizeof(EntityId)));
 
-                    if (node->WasJustCreated())
-                    {
-                        ownerCacheMap[node->GetAbsolutePath()] = node->GetOwningClient().value_or(0);
+            NetworkEntityTable::WriteReference(result, operation.entityId, operation.path);
 
-                        PushOp(templateSnapshot.operationBlob, OpCreate{ node->GetAbsolutePath(), node->GetTypeName(), node->GetOwningClient() });
-                        ++templateSnapshot.header.operationCount;
+            CommonNetwork::WriteRaw(result, operation.bytes.data() + tail, operation.bytes.size() - tail);
 
-                        for (auto& component : node->GetComponentMap() | std::views::values)
-                        {
-                            if (!component->ShouldSynchronize())
-                                continue;
+            return result;
+        }
 
-                            PushOp(templateSnapshot.operationBlob, OpAddComponent{ node->GetAbsolutePath(), static_cast<int>(Utility::TypeRegistrar::GetIdFromRuntimeName(component->GetTypeName()).value()), CommonNetwork::SerializePointerToBlob(component) });
+        std::optional<std::vector<std::uint8_t>> EncodeAgainstBaseline(const BaselineRing& ring, const PendingOperation& operation, const std::uint64_t acked, const EntityId entityId, std::shared_ptr<const std::vector<std::uint8_t>>& fullBlob)
+        {
+            if (!operation.coalesceKey.has_value() || !operation.fullState)
+                return std::nullopt;
 
-                            ++templateSnapshot.header.operationCount;
+            const OpSetField& setField = *operation.fullState;
 
-                            component->ClearWasAdded();
+            std::optional<std::vector<std::uint8_t>> result;
 
-                            RememberHash(component);
-                        }
+            if (const auto baseline = ring.FindNewestAcked(operation.coalesceKey.value(), acked); baseline.has_value())
+            {
+                std::vector<std::uint8_t> delta = BaselineRing::EncodeDelta(*baseline->blob, setField.blob);
 
-                        node->ClearJustCreated();
-                    }
+                if (delta.size() < setField.blob.size())
+                {
+                    result.emplace();
+
+                    PushOp(result.value(), OpDeltaField{ setField.path, setField.componentType, baseline->sequence, std::move(delta), entityId });
                 }
+            }
 
-                for (const auto& [gameObject, componentType] : dirtyComponentSet)
-                {
-                    const auto gameObjectPointer = gameObject.lock();
+            fullBlob = std::shared_ptr<const std::vector<std::uint8_t>>(operation.fullState, &setField.blob);
 
-                    if (!gameObjectPointer)
-                        continue;
+            return result;
+        }
 
-                    const auto componentIterator = gameObjectPointer->GetComponentMap().find(componentType);
+        void BuildInterestChange(const NetworkId id, const Blaster::Server::Network::InterestChange& change, SnapshotTemplate& snapshotTemplate, const std::unordered_set<std::string>* pendingSet)
+        {
+            for (const std::string& path : change.leftList)
+            {
+                if (pendingSet != nullptr && pendingSet->contains(path))
+                    continue;
 
-                    if (componentIterator == gameObjectPointer->GetComponentMap().end())
-                    {
-                        PushOp(templateSnapshot.operationBlob, OpRemoveComponent{ gameObjectPointer->GetAbsolutePath(), static_cast<int>(Utility::TypeRegistrar::GetIdFromRuntimeName(componentType.name()).value()) });
+                snapshotTemplate.Push(OpDestroy{ path }, 0);
 
-                        ++templateSnapshot.header.operationCount;
+                if (const auto ring = baselineMap.find(id); ring != baselineMap.end())
+                    ring->second.ForgetPath(path);
+            }
 
-                        ForgetHash(componentIterator->second);
+            for (const std::string& path : change.enteredList)
+            {
+                if (pendingSet != nullptr && pendingSet->contains(path))
+                    continue;
 
-                        continue;
-                    }
+                std::shared_ptr<IGameObjectSynchronization> node;
 
-                    if (const auto& component = componentIterator->second; component->WasAdded())
-                    {
-                        if (!component->ShouldSynchronize())
-                            continue;
+                {
+                    std::lock_guard guard(interestMutex);
 
-                        if (HasStateChanged(component))
-                        {
-                            PushOp(templateSnapshot.operationBlob, OpAddComponent{ gameObjectPointer->GetAbsolutePath(), static_cast<int>(Utility::TypeRegistrar::GetIdFromRuntimeName(component->GetTypeName()).value()), CommonNetwork::SerializePointerToBlob(component) });
-                            component->ClearWasAdded();
+                    if (const auto hit = interestRootMap.find(path); hit != interestRootMap.end())
+                        node = hit->second.lock();
+                }
 
-                            ++templateSnapshot.header.operationCount;
-                        }
-                    }
-                    else
-                    {
-                        if (!component->ShouldSynchronize())
-                            continue;
+                if (node && !node->IsDestroyed())
+                    SerializeSubTree(node, snapshotTemplate);
+            }
+        }
 
-                        if (HasStateChanged(component))
-                        {
-                            const std::vector<std::uint8_t> blob = CommonNetwork::SerializePointerToBlob(component);
+        void ForgetInterest(const std::string& path)
+        {
+            {
+                std::lock_guard guard(interestMutex);
+                interestRootMap.erase(path);
+            }
 
-                            PushOp(templateSnapshot.operationBlob, OpSetField{ gameObjectPointer->GetAbsolutePath(), static_cast<int>(Utility::TypeRegistrar::GetIdFromRuntimeName(component->GetTypeName()).value()), "ALL", blob });
-                            
-                            ++templateSnapshot.header.operationCount;
-                        }
-                    }
-                }
+            for (auto& priorityMap : clientPriorityMap | std::views::values)
+                priorityMap.erase(path);
+
+            Blaster::Server::Network::InterestGrid::GetInstance().Remove(path);
+        }
+
+        std::size_t SendJoinChunk(const NetworkId id, JoinStream& stream, const std::size_t limit)
+        {
+            if (!stream.started)
+            {
+                stream.started = true;
 
-                dirtyComponentSet.clear();
-                dirtyGameObjectSet.clear();
+                baselineMap.erase(id);
+                bindingMap.erase(id);
             }
 
-            if (templateSnapshot.header.operationCount == 0)
-                return;
+            SnapshotTemplate chunkTemplate{};
 
-#ifdef IS_SERVER
-            for (const NetworkId id : Blaster::Server::Network::ServerNetwork::GetInstance().GetConnectedClients())
+            Snapshot& snapshot = chunkTemplate.snapshot;
+
+            snapshot.header.operationCount = 0;
+            snapshot.header.route = Route::ServerBroadcast;
+            snapshot.header.origin = 0;
+            snapshot.header.tick = SnapshotScheduler::GetInstance().GetTick();
+
+            while (stream.nextRoot < stream.rootList.size() && snapshot.operationBlob.size() < limit)
             {
-                Snapshot snapshot = templateSnapshot;
+                const JoinRoot& root = stream.rootList[stream.nextRoot++];
 
-                uint32_t operationCount;
+                stream.pendingSet.erase(root.path);
 
-                FilterOpsForClient(id, snapshot.operationBlob, operationCount);
+                if (root.distance <= kEssentialRadius)
+                    --stream.essentialRemaining;
 
-                snapshot.header.operationCount = operationCount;
+                const auto node = root.node.lock();
 
-                if (snapshot.header.operationCount == 0)
+                if (!node || node->IsDestroyed() || !Blaster::Server::Network::InterestGrid::GetInstance().IsInterested(id, root.path))
                     continue;
 
-                snapshot.header.sequence = SyncTracker::GetInstance().AllocateSequence(id);
-                snapshot.header.ack = SyncTracker::GetInstance().GetLastIncoming(id);
+                SerializeSubTree(node, chunkTemplate);
+            }
 
-                Blaster::Server::Network::ServerNetwork::GetInstance().SendTo(id, PacketType::S2C_Snapshot, snapshot);
+            std::uint8_t flags = static_cast<std::uint8_t>(WorldChunkFlag::None);
 
-                std::cout << "Sent snapshot to client '" << id << "' with seqence '" << snapshot.header.sequence << "' and ack '" << snapshot.header.ack << "' ('" << snapshot.header.operationCount << "' operations)!" << std::endl;
-            }
-#else
+            if (stream.essentialRemaining == 0 && !stream.essentialSent)
             {
-                constexpr NetworkId ServerId = 0;
+                stream.essentialSent = true;
 
-                Snapshot snapshot = templateSnapshot;
+                flags |= static_cast<std::uint8_t>(WorldChunkFlag::Essential);
+            }
 
-                snapshot.header.sequence = SyncTracker::GetInstance().AllocateSequence(ServerId);
-                snapshot.header.ack = SyncTracker::GetInstance().GetLastIncoming(ServerId);
+            if (stream.nextRoot == stream.rootList.size())
+                flags |= static_cast<std::uint8_t>(WorldChunkFlag::Final);
 
-                Blaster::Client::Network::ClientNetwork::GetInstance().Send(PacketType::C2S_Snapshot, snapshot);
+            snapshot.header.sequence = SyncTracker::GetInstance().AllocateSequence(id);
+            snapshot.header.ack = SyncTracker::GetInstance().GetLastIncoming(id);
 
-                std::cout << "Sent snapshot to server with seqence '" << snapshot.header.sequence << "' and ack '" << snapshot.header.ack << "' ('" << snapshot.header.operationCount << "' operations)!" << std::endl;
-            }
-#endif
-             
-            for (auto iterator = lastHashMap.begin(); iterator != lastHashMap.end(); )
+            PeerEntityBindings& bindings = bindingMap[id];
+
+            for (const TaggedOperation& tag : chunkTemplate.operationList)
             {
-                if (iterator->first == nullptr)
-                {
-                    std::cerr << "Items in the lastHashMap variable in SenderSynchronization had null keys. This shouldn't happen!" << std::endl;
-                    iterator = lastHashMap.erase(iterator);
-                }
-                else
-                    ++iterator;
+                if (tag.code == OpCode::Create || tag.code == OpCode::Spawn)
+                    bindings.Record(tag.path, tag.entityId, snapshot.header.sequence);
             }
-        }
-
-        void SynchronizeFullTree(const NetworkId targetClient, const std::vector<std::shared_ptr<GameObject>>& gameObjectList)
-        {
-            Snapshot snapshot;
 
-            snapshot.header.operationCount = 0;
-            snapshot.header.sequence = SyncTracker::GetInstance().AllocateSequence(targetClient);
-            snapshot.header.ack = SyncTracker::GetInstance().GetLastIncoming(targetClient);
+            const std::span<const std::uint8_t> payload = CommonNetwork::AssembleData(snapshot);
+            const std::size_t rawSize = payload.size();
 
-#ifdef IS_SERVER
-            snapshot.header.route = Route::ServerBroadcast;
-            snapshot.header.origin = 0;
-#else
-            snapshot.header.route = Route::RelayOnce;
-            snapshot.header.origin = Blaster::Client::Network::ClientNetwork::GetInstance().GetNetworkId();
-#endif
+            const WorldChunk chunk = WorldChunkCodec::Compress(stream.nextChunk++, flags, payload);
 
-            for (const auto& root : gameObjectList)
-                SerializeSubTree(std::static_pointer_cast<IGameObjectSynchronization>(root), snapshot);
+            Blaster::Server::Network::ServerNetwork::GetInstance().SendTo(id, PacketType::S2C_WorldChunk, chunk);
+            SyncTracker::GetInstance().RecordOutgoing(id, snapshot);
 
-#ifdef IS_SERVER
-            Blaster::Server::Network::ServerNetwork::GetInstance().SendTo(targetClient, PacketType::S2C_Snapshot, snapshot);
-#else
-            Blaster::Client::Network::ClientNetwork::GetInstance().Send(PacketType::C2S_Snapshot, snapshot);
-#endif
+            return rawSize;
         }
 
-        void RememberHash(const std::shared_ptr<Component>& comp)
+        void ScheduleDrain()
         {
-            const uint64_t handle = ComponentStateHash(comp);
+            drainPending.store(true, std::memory_order_release);
 
-            lastHashMap[comp.get()] = handle;
+            WakeFlusher();
         }
 
-        void ForgetHash(const std::shared_ptr<Component>& comp)
+        void DrainPending()
         {
-            lastHashMap.erase(comp.get());
+            drainPending.store(false, std::memory_order_release);
+
+            SnapshotTemplate snapshotTemplate{};
+
+            snapshotTemplate.snapshot.header.operationCount = 0;
+            snapshotTemplate.snapshot.header.tick = SnapshotScheduler::GetInstance().GetStampTick();
+            snapshotTemplate.snapshot.header.route = Route::ServerBroadcast;
+            snapshotTemplate.snapshot.header.origin = 0;
+
+            if (BuildClientSnapshots(GetSessionClients(), snapshotTemplate))
+                ScheduleDrain();
         }
+#endif
 
-        static SenderSynchronization& GetInstance()
+        void SerializeSubTree(const std::shared_ptr<IGameObjectSynchronization>& node, SnapshotTemplate& snapshotTemplate)
         {
-            std::call_once(initializationFlag, [&]()
+            const NetworkId owner = node->GetOwningClient().value_or(0);
+
+            if (const auto prefab = FindPrefab(node))
+                PushSpawn(node, *prefab, [&](const auto& operation) { snapshotTemplate.Push(operation, owner); }, false);
+            else if (!node->IsPrefabMember())
             {
-                instance = std::unique_ptr<SenderSynchronization>(new SenderSynchronization());
-            });
+                snapshotTemplate.Push(OpCreate{ node->GetAbsolutePath(), node->GetTypeName(), node->GetOwningClient(), ResolveEntityId(node->GetAbsolutePath()) }, owner);
 
-            return *instance;
-        }
+                for (const auto& component : node->GetComponentOrder())
+                {
+                    const std::vector<std::uint8_t> blob = CommonNetwork::SerializePointerToBlob(component);
 
-    private:
+                    snapshotTemplate.Push(OpAddComponent{ node->GetAbsolutePath(), static_cast<int>(Utility::TypeRegistrar::GetIdFromRuntimeName(component->GetTypeName()).value()), blob }, owner);
+                }
+            }
 
-        SenderSynchronization() = default;
+            for (const auto& child : node->GetChildMap() | std::views::values)
+                SerializeSubTree(std::static_pointer_cast<IGameObjectSynchronization>(child), snapshotTemplate);
+        }
 
-        void WakeFlusher()
+        template <typename Push>
+        void PushSpawn(const std::shared_ptr<IGameObjectSynchronization>& node, const Prefab& prefab, Push&& push, const bool flushing)
         {
-            bool expected = false;
+            const std::string path = node->GetAbsolutePath();
 
-            const bool firstWriter = flushRequested.compare_exchange_strong(expected, true, std::memory_order_release, std::memory_order_relaxed);
+            OpSpawn spawn{ path, prefab.GetId(), node->GetOwningClient(), {}, ResolveEntityId(path) };
 
-            if (firstWriter)
+            std::vector<OpDestroy> destroyList;
+            std::vector<OpAddComponent> addList;
+            std::vector<OpRemoveComponent> removeList;
+
+            for (const PrefabNode& prefabNode : prefab.GetNodeList())
             {
-#ifdef IS_SERVER
-                boost::asio::post(Blaster::Server::Network::ServerNetwork::GetInstance().GetIoContext(), [this]
-                    {
-                        MainThreadExecutor::GetInstance().EnqueueTask(nullptr, [this]()
-                            {
-                                FlushDirty();
-                            });
-                    });
-#else
-                boost::asio::post(Blaster::Client::Network::ClientNetwork::GetInstance().GetIoContext(), [this]
+                const std::string memberPath = prefabNode.relativePath.empty() ? path : path + "." + prefabNode.relativePath;
+
+                const auto member = FindPrefabMember(node, prefabNode.relativePath);
+
+                if (!member || member->IsDestroyed())
+                {
+                    destroyList.push_back(OpDestroy{ memberPath });
+                    continue;
+                }
+
+                if (flushing && member != node)
+                    member->ClearJustCreated();
+
+                for (const auto& component : member->GetComponentOrder())
+                {
+                    if (flushing && !component->ShouldSynchronize())
+                        continue;
+
+                    const int componentTypeId = static_cast<int>(Utility::TypeRegistrar::GetIdFromRuntimeName(component->GetTypeName()).value());
+
+                    const auto source = std::ranges::find(prefabNode.componentList, componentTypeId, &PrefabComponent::componentType);
+
+                    if (source == prefabNode.componentList.end())
+                        addList.push_back(OpAddComponent{ memberPath, componentTypeId, CommonNetwork::SerializePointerToBlob(component) });
+                    else if (auto patch = Prefab::MakeOverride(prefabNode.relativePath, *source, component); patch.has_value())
+                        spawn.overrideList.push_back(std::move(patch.value()));
+
+                    if (flushing)
                     {
-                        MainThreadExecutor::GetInstance().EnqueueTask(nullptr, [this]()
-                            {
-                                FlushDirty();
-                            });
-                    });
-#endif
+                        component->ClearWasAdded();
+
+                        RememberHash(component);
+                    }
+                }
+
+                for (const PrefabComponent& source : prefabNode.componentList)
+                {
+                    const std::string typeName = Utility::TypeRegistrar::GetRuntimeName(source.componentType);
+
+                    if (std::ranges::none_of(member->GetComponentOrder(), [&](const auto& component) { return component->GetTypeName() == typeName; }))
+                        removeList.push_back(OpRemoveComponent{ memberPath, source.componentType });
+                }
             }
+
+            push(spawn);
+
+            for (const auto& operation : destroyList)
+                push(operation);
+
+            for (const auto& operation : addList)
+                push(operation);
+
+            for (const auto& operation : removeList)
+                push(operation);
+        }
+
+        static std::shared_ptr<Prefab> FindPrefab(const std::shared_ptr<IGameObjectSynchronization>& node)
+        {
+            const auto prefabId = node->GetPrefabId();
+
+            if (!prefabId.has_value())
+                return nullptr;
+
+            return PrefabManager::GetInstance().Get(prefabId.value()).value_or(nullptr);
         }
 
-        void SerializeSubTree(const std::shared_ptr<IGameObjectSynchronization>& node, Snapshot& snap)
+        static std::shared_ptr<IGameObjectSynchronization> FindPrefabMember(const std::shared_ptr<IGameObjectSynchronization>& root, const std::string& relativePath)
         {
-            PushOp(snap.operationBlob, OpCreate{ node->GetAbsolutePath(), node->GetTypeName(), node->GetOwningClient() });
-            ++snap.header.operationCount;
+            std::shared_ptr<IGameObjectSynchronization> current = root;
 
-            for (const auto& component : node->GetComponentOrder())
+            std::size_t start = 0;
+
+            while (current && start < relativePath.size())
             {
-                const std::vector<std::uint8_t> blob = CommonNetwork::SerializePointerToBlob(component);
+                const std::size_t end = std::min(relativePath.find('.', start), relativePath.size());
+
+                const auto& childMap = current->GetChildMap();
+                const auto iterator = childMap.find(relativePath.substr(start, end - start));
 
-                PushOp(snap.operationBlob, OpAddComponent{ node->GetAbsolutePath(), static_cast<int>(Utility::TypeRegistrar::GetIdFromRuntimeName(component->GetTypeName()).value()), blob });
+                current = iterator == childMap.end() ? nullptr : std::static_pointer_cast<IGameObjectSynchronization>(iterator->second);
 
-                ++snap.header.operationCount;
+                start = end + 1;
             }
 
-            for (const auto& child : node->GetChildMap() | std::views::values)
-                SerializeSubTree(std::static_pointer_cast<IGameObjectSynchronization>(child), snap);
+            return current;
+        }
+
+        template <typename Op>
+        void PushTemplateOp(SnapshotTemplate& snapshotTemplate, const Op& operation)
+        {
+            const auto owner = ownerCacheMap.find(std::string(GetRoot(operation.path)));
+
+            snapshotTemplate.Push(operation, owner == ownerCacheMap.end() ? 0 : owner->second);
         }
 
         template <typename Op>
@@ -434,55 +1559,40 @@ namespace Blaster::Independent::ECS::Synchronization
 
         bool HasStateChanged(const std::shared_ptr<Component>& comp)
         {
-            const uint64_t hash = ComponentStateHash(comp);
-
-            auto iterator = lastHashMap.find(comp.get());
-            const bool dirty = (iterator == lastHashMap.end()) || (iterator->second != hash);
-
-            if (dirty)
-                lastHashMap[comp.get()] = hash;
+            std::uint64_t fieldMask = 0;
 
-            return dirty;
+            return HasStateChanged(comp, fieldMask);
         }
 
-        void FilterOpsForClient(NetworkId target, std::vector<uint8_t>& blob, uint32_t& opCount)
+        bool HasStateChanged(const std::shared_ptr<Component>& comp, std::uint64_t& fieldMask)
         {
-            std::vector<uint8_t> out;
-            uint32_t kept = 0;
+            fieldMask = 0;
 
-            size_t off = 0;
-
-            while (off < blob.size())
+            if (const auto mask = MergeSupport::DiffFields(comp, fieldShadowMap[comp.get()]); mask.has_value())
             {
-                const OpCode code = static_cast<OpCode>(blob[off]); off += 1;
-                const uint32_t len = *reinterpret_cast<const uint32_t*>(&blob[off]);
-                off += 4;
+                fieldMask = mask.value();
 
-                std::string path;
-                {
-                    std::span<const uint8_t> data(&blob[off], len);
-                    size_t pathOff = 0;
-                    path = CommonNetwork::DecodeString(data, pathOff);
-                }
+                return fieldMask != 0;
+            }
 
-                const std::string root(GetRoot(path));
-                const auto it = ownerCacheMap.find(root);
-                const NetworkId owner = (it == ownerCacheMap.end()) ? 0 : it->second;
+            const uint64_t hash = ComponentStateHash(comp);
 
-                if (owner != target)
-                {
-                    CommonNetwork::WriteTrivial(out, static_cast<uint8_t>(code));
-                    CommonNetwork::WriteTrivial(out, len);
-                    CommonNetwork::WriteRaw(out, &blob[off], len);
+            auto iterator = lastHashMap.find(comp.get());
+            const bool dirty = (iterator == lastHashMap.end()) || (iterator->second != hash);
 
-                    ++kept;
-                }
+            if (dirty)
+                lastHashMap[comp.get()] = hash;
 
-                off += len;
-            }
+            return dirty;
+        }
 
-            blob.swap(out);
-            opCount = kept;
+        static EntityId ResolveEntityId(const std::string& path)
+        {
+#ifdef IS_SERVER
+            return NetworkEntityTable::GetInstance().Assign(path);
+#else
+            return NetworkEntityTable::GetInstance().FindId(path).value_or(0);
+#endif
         }
 
         static std::string_view GetRoot(std::string_view absolutePath)
@@ -492,17 +1602,50 @@ namespace Blaster::Independent::ECS::Synchronization
             return dot == std::string_view::npos ? absolutePath : absolutePath.substr(0, dot);
         }
 
-        std::unordered_set<std::shared_ptr<IGameObjectSynchronization>> dirtyGameObjectSet;
-        std::unordered_set<DirtyCompKey, DirtyCompHash, DirtyCompEqual> dirtyComponentSet;
+        std::vector<std::unique_ptr<DirtyJournal>> journalList;
+        std::mutex journalMutex;
+
+        std::atomic<std::uint64_t> dirtyEpoch = 1;
 
         std::atomic<bool> flushRequested = false;
         std::atomic<std::uint64_t> nextSeq = 1;
 
         std::unordered_map<const Component*, std::uint64_t> lastHashMap;
+        std::unordered_map<const Component*, std::shared_ptr<void>> fieldShadowMap;
 
-        std::shared_mutex dirtyMutex;
+        std::mutex ownerMutex;
 
         std::unordered_map<std::string, NetworkId> ownerCacheMap;
+        std::unordered_map<std::string, NetworkId> pendingOwnerMap;
+
+#ifdef IS_SERVER
+        static constexpr std::size_t kMinimumDrainBytes = 512;
+
+        static constexpr float kPlayerPriority = 4.0f;
+        static constexpr float kPropPriority = 1.0f;
+        static constexpr float kPriorityFalloff = 64.0f;
+
+        static constexpr std::size_t kJoinBytesPerTick = 256 * 1024;
+        static constexpr std::size_t kJoinChunkBytes = 64 * 1024;
+        static constexpr float kEssentialRadius = 512.0f;
+
+        std::unordered_map<NetworkId, ClientBacklog> backlogMap;
+        std::unordered_map<NetworkId, BaselineRing> baselineMap;
+        std::unordered_map<NetworkId, PeerEntityBindings> bindingMap;
+        std::unordered_map<NetworkId, std::unordered_map<std::string, float>> clientPriorityMap;
+
+        std::unordered_map<std::string, std::weak_ptr<IGameObjectSynchronization>> interestRootMap;
+        std::mutex interestMutex;
+
+        std::unordered_map<NetworkId, JoinStream> joinStreamMap;
+        std::shared_mutex joinMutex;
+
+        std::uint64_t priorityTick{ 0 };
+
+        std::atomic<bool> drainPending = false;
+#else
+        std::uint64_t lastAckSent = 0;
+#endif
 
         static std::once_flag initializationFlag;
         static std::unique_ptr<SenderSynchronization> instance;
@@ -0,0 +1,210 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include "Independent/Network/CommonNetwork.hpp"
+
+using namespace Blaster::Independent::Network;
+
+namespace Blaster::Independent::ECS::Synchronization
+{
+    class SnapshotScheduler final
+    {
+
+    public:
+
+        using Clock = std::chrono::steady_clock;
+
+        SnapshotScheduler(const SnapshotScheduler&) = delete;
+        SnapshotScheduler(SnapshotScheduler&&) = delete;
+        SnapshotScheduler& operator=(const SnapshotScheduler&) = delete;
+        SnapshotScheduler& operator=(SnapshotScheduler&&) = delete;
+
+        void Configure(const std::uint32_t snapshotRate)
+        {
+            std::lock_guard guard(mutex);
+
+            snapshotInterval = MakeInterval(std::clamp(snapshotRate, 1u, kTickRate));
+            nextSnapshot = Clock::now();
+        }
+
+        void SetClientRate(const NetworkId id, const std::uint32_t snapshotRate)
+        {
+            std::lock_guard guard(mutex);
+
+            if (snapshotRate == 0)
+            {
+                clientMap.erase(id);
+                return;
+            }
+
+            clientMap[id] = { MakeInterval(std::min(snapshotRate, kTickRate)), Clock::now() };
+        }
+
+        void ForgetClient(const NetworkId id)
+        {
+            std::lock_guard guard(mutex);
+
+            clientMap.erase(id);
+        }
+
+        bool ConsumeSnapshot()
+        {
+            std::lock_guard guard(mutex);
+
+            return Consume(nextSnapshot, snapshotInterval, Clock::now());
+        }
+
+        bool ConsumeDrain()
+        {
+            std::lock_guard guard(mutex);
+
+            return Consume(nextDrain, kDrainInterval, Clock::now());
+        }
+
+        bool ConsumeAck()
+        {
+            std::lock_guard guard(mutex);
+
+            return Consume(nextAck, kAckInterval, Clock::now());
+        }
+
+        bool ConsumeClient(const NetworkId id, const Clock::time_point now)
+        {
+            std::lock_guard guard(mutex);
+
+            const auto hit = clientMap.find(id);
+
+            if (hit == clientMap.end())
+                return true;
+
+            return Consume(hit->second.next, hit->second.interval, now);
+        }
+
+        void ObserveServerTick(const std::uint64_t tick)
+        {
+            std::lock_guard guard(mutex);
+
+            const auto now = Clock::now();
+
+            if (serverTickAnchor.has_value() && std::abs(EstimateServerTick(now) - static_cast<double>(tick)) <= kServerTickTolerance)
+                return;
+
+            serverTickAnchor = tick;
+            serverTickTime = now;
+        }
+
+        [[nodiscard]]
+        std::uint64_t GetTick() const
+        {
+            return static_cast<std::uint64_t>((Clock::now() - tickOrigin) / MakeInterval(kTickRate));
+        }
+
+        [[nodiscard]]
+        double GetServerTick() const
+        {
+            std::lock_guard guard(mutex);
+
+            const auto now = Clock::now();
+
+            if (!serverTickAnchor.has_value())
+                return std::chrono::duration<double>(now - tickOrigin).count() * kTickRate;
+
+            return EstimateServerTick(now);
+        }
+
+        [[nodiscard]]
+        std::uint64_t GetStampTick() const
+        {
+#ifdef IS_SERVER
+            return GetTick();
+#else
+            return static_cast<std::uint64_t>(std::max(0.0, GetServerTick()));
+#endif
+        }
+
+        static constexpr float GetTickInterval()
+        {
+            return 1.0f / static_cast<float>(kTickRate);
+        }
+
+        static constexpr std::uint32_t kTickRate = 60;
+
+        static SnapshotScheduler& GetInstance()
+        {
+            std::call_once(initializationFlag, [&]()
+            {
+                instance = std::unique_ptr<SnapshotScheduler>(new SnapshotScheduler());
+            });
+
+            return *instance;
+        }
+
+    private:
+
+        struct ClientRate
+        {
+            Clock::duration interval;
+            Clock::time_point next;
+        };
+
+        SnapshotScheduler() = default;
+
+        static bool Consume(Clock::time_point& next, const Clock::duration interval, const Clock::time_point now)
+        {
+            if (now < next)
+                return false;
+
+            next += interval;
+
+            if (next <= now)
+                next = now + interval;
+
+            return true;
+        }
+
+        [[nodiscard]]
+        double EstimateServerTick(const Clock::time_point now) const
+        {
+            return static_cast<double>(serverTickAnchor.value()) + std::chrono::duration<double>(now - serverTickTime).count() * kTickRate;
+        }
+
+        static Clock::duration MakeInterval(const std::uint32_t rate)
+        {
+            return std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / rate));
+        }
+
+        const Clock::time_point tickOrigin{ Clock::now() };
+
+        Clock::duration snapshotInterval{ MakeInterval(kDefaultSnapshotRate) };
+        Clock::time_point nextSnapshot{ Clock::now() };
+        Clock::time_point nextDrain{ Clock::now() };
+        Clock::time_point nextAck{ Clock::now() };
+
+        std::unordered_map<NetworkId, ClientRate> clientMap;
+
+        std::optional<std::uint64_t> serverTickAnchor;
+        Clock::time_point serverTickTime;
+
+        mutable std::mutex mutex;
+
+        static constexpr std::uint32_t kDefaultSnapshotRate = 30;
+
+        static constexpr Clock::duration kDrainInterval = std::chrono::milliseconds(16);
+        static constexpr Clock::duration kAckInterval = std::chrono::milliseconds(16);
+
+        static constexpr double kServerTickTolerance = 4.0;
+
+        static std::once_flag initializationFlag;
+        static std::unique_ptr<SnapshotScheduler> instance;
+
+    };
+
+    std::once_flag SnapshotScheduler::initializationFlag;
+    std::unique_ptr<SnapshotScheduler> SnapshotScheduler::instance;
+}
\ No newline at end of file
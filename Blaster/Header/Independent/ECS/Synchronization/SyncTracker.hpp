@@ -1,6 +1,7 @@
 #pragma once
 
 #include <unordered_set>
+#include <deque>
 #include <queue>
 #include <shared_mutex>
 #include <chrono>
@@ -17,6 +18,14 @@
 
 namespace Blaster::Independent::ECS::Synchronization
 {
+    struct SentSnapshotRecord
+    {
+        uint64_t watermark{ 0 };
+        bool relayed{ false };
+
+        Snapshot snapshot;
+    };
+
     struct PeerSyncState
     {
         uint64_t lastOutgoingSequence{ 0 };
@@ -24,6 +33,9 @@ namespace Blaster::Independent::ECS::Synchronization
         uint64_t lastAckedOutgoing{ 0 };
 
         std::unordered_set<uint64_t> unackedOutgoing{};
+
+        std::deque<SentSnapshotRecord> history{};
+        std::optional<uint64_t> evictedWatermark{};
     };
 
     class SyncTracker final
@@ -70,6 +82,54 @@ namespace Blaster::Independent::ECS::Synchronization
                 else
                     ++it;
             }
+
+            while (!state.history.empty() && state.history.front().watermark < state.lastAckedOutgoing)
+                EvictOldest(state);
+        }
+
+        void RecordOutgoing(NetworkId peer, const Snapshot& snapshot, bool relayed = false)
+        {
+            std::unique_lock guard(mutex);
+
+            auto& state = peerStateMap[peer];
+
+            state.history.push_back({ relayed ? state.lastOutgoingSequence : snapshot.header.sequence, relayed, snapshot });
+
+            while (state.history.size() > kHistoryLimit)
+                EvictOldest(state);
+        }
+
+        [[nodiscard]]
+        std::optional<std::vector<Snapshot>> CollectSince(NetworkId peer, uint64_t sequence)
+        {
+            std::shared_lock guard(mutex);
+
+            const auto it = peerStateMap.find(peer);
+
+            if (sequence == 0 || it == peerStateMap.end() || sequence > it->second.lastOutgoingSequence)
+                return std::nullopt;
+
+            const auto& state = it->second;
+
+            if (state.evictedWatermark.has_value() && state.evictedWatermark.value() >= sequence)
+                return std::nullopt;
+
+            std::vector<Snapshot> result;
+
+            for (const auto& record : state.history)
+            {
+                if (record.relayed ? record.watermark >= sequence : record.watermark > sequence)
+                    result.push_back(record.snapshot);
+            }
+
+            return result;
+        }
+
+        void ForgetPeer(NetworkId peer)
+        {
+            std::unique_lock guard(mutex);
+
+            peerStateMap.erase(peer);
         }
 
         [[nodiscard]]
@@ -106,6 +166,14 @@ namespace Blaster::Independent::ECS::Synchronization
 
         SyncTracker() = default;
 
+        static void EvictOldest(PeerSyncState& state)
+        {
+            state.evictedWatermark = std::max(state.evictedWatermark.value_or(0), state.history.front().watermark);
+            state.history.pop_front();
+        }
+
+        static constexpr std::size_t kHistoryLimit = 256;
+
         std::unordered_map<NetworkId, PeerSyncState> peerStateMap{};
         std::shared_mutex mutex{};
 
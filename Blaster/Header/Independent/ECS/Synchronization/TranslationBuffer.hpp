@@ -3,6 +3,7 @@
 #include <unordered_map>
 #include <memory>
 #include <chrono>
+#include "Independent/ECS/Synchronization/SnapshotScheduler.hpp"
 #include "Independent/Math/Transform3d.hpp"
 #include "Independent/Utility/Time.hpp"
 
@@ -22,12 +23,23 @@ namespace Blaster::Independent::ECS::Synchronization
         TranslationBuffer& operator=(const TranslationBuffer&) = delete;
         TranslationBuffer& operator=(TranslationBuffer&&) = delete;
 
-        void Enqueue(const std::shared_ptr<Blaster::Independent::Math::Transform3d>& transform, const Blaster::Independent::Math::Vector<float, 3>& position, const Blaster::Independent::Math::Vector<float, 3>& rotation, const Blaster::Independent::Math::Vector<float, 3>& scale)
+        void Enqueue(const std::shared_ptr<Blaster::Independent::Math::Transform3d>& transform, const std::uint64_t tick, const Blaster::Independent::Math::Vector<float, 3>& position, const Blaster::Independent::Math::Vector<float, 3>& rotation, const Blaster::Independent::Math::Vector<float, 3>& scale, const Blaster::Independent::Math::Vector<float, 3>& linearVelocity = { 0.0f, 0.0f, 0.0f }, const Blaster::Independent::Math::Vector<float, 3>& angularVelocity = { 0.0f, 0.0f, 0.0f })
         {
             using Transform3d = Blaster::Independent::Math::Transform3d;
 
             Entry& entry = entryMap[transform.get()];
 
+            if (tick != 0 && entry.lastTick != 0)
+            {
+                if (tick <= entry.lastTick)
+                    return;
+
+                entry.interval = std::clamp(static_cast<float>(tick - entry.lastTick) * SnapshotScheduler::GetTickInterval(), SnapshotScheduler::GetTickInterval(), kMaximumInterval);
+            }
+
+            if (tick != 0)
+                entry.lastTick = tick;
+
             entry.transform = transform;
             entry.startingPosition = transform->GetLocalPosition();
             entry.startingRotation = transform->GetLocalRotation();
@@ -35,14 +47,17 @@ namespace Blaster::Independent::ECS::Synchronization
             entry.targetPosition = position;
             entry.targetRotation = rotation;
             entry.targetScale = scale;
+            entry.linearVelocity = linearVelocity;
+            entry.angularVelocity = angularVelocity;
             entry.progress = 0.0f;
+            entry.elapsed = 0.0f;
         }
 
         void Update()
         {
             namespace Math = Blaster::Independent::Math;
 
-            const float snapInterval = 0.10f;
+            const float maximumExtrapolation = 1.5f;
             auto iterator = entryMap.begin();
 
             while (iterator != entryMap.end())
@@ -56,17 +71,23 @@ namespace Blaster::Independent::ECS::Synchronization
                     continue;
                 }
 
-                entry.progress += Time::GetInstance().GetDeltaTime() / snapInterval;
+                entry.progress += Time::GetInstance().GetDeltaTime() / entry.interval;
+                entry.elapsed = std::min(entry.elapsed + Time::GetInstance().GetDeltaTime(), maximumExtrapolation);
 
                 const float t = std::clamp(entry.progress, 0.0f, 1.0f);
 
                 const auto lerp = [t](const Math::Vector<float, 3>& a, const Math::Vector<float, 3>& b) { return a + (b - a) * t; };
 
-                transform->SetLocalPosition(lerp(entry.startingPosition, entry.targetPosition), false);
-                transform->SetLocalRotation(lerp(entry.startingRotation, entry.targetRotation), false);
+                const Math::Vector<float, 3> extrapolatedPosition = entry.targetPosition + entry.linearVelocity * entry.elapsed;
+                const Math::Vector<float, 3> extrapolatedRotation = entry.targetRotation + entry.angularVelocity * entry.elapsed;
+
+                transform->SetLocalPosition(lerp(entry.startingPosition, extrapolatedPosition), false);
+                transform->SetLocalRotation(lerp(entry.startingRotation, extrapolatedRotation), false);
                 transform->SetLocalScale(lerp(entry.startingScale, entry.targetScale), false);
 
-                if (t >= 1.0f)
+                const bool moving = entry.linearVelocity != Math::Vector<float, 3>{ 0.0f, 0.0f, 0.0f } || entry.angularVelocity != Math::Vector<float, 3>{ 0.0f, 0.0f, 0.0f };
+
+                if (t >= 1.0f && (!moving || entry.elapsed >= maximumExtrapolation))
                     iterator = entryMap.erase(iterator);
                 else
                     ++iterator;
@@ -93,10 +114,18 @@ namespace Blaster::Independent::ECS::Synchronization
 
             Blaster::Independent::Math::Vector<float, 3> startingPosition, startingRotation, startingScale;
             Blaster::Independent::Math::Vector<float, 3> targetPosition, targetRotation, targetScale;
+            Blaster::Independent::Math::Vector<float, 3> linearVelocity, angularVelocity;
+
+            std::uint64_t lastTick = 0;
+            float interval = kDefaultInterval;
 
             float progress = 0.0f;
+            float elapsed = 0.0f;
         };
 
+        static constexpr float kDefaultInterval = 0.10f;
+        static constexpr float kMaximumInterval = 0.25f;
+
         std::unordered_map<const void*, Entry> entryMap;
 
         static std::once_flag initializationFlag;
@@ -13,6 +13,7 @@
 #include "Independent/ECS/Component.hpp"
 #include "Independent/ECS/ComponentFactory.hpp"
 #include "Independent/Math/Matrix.hpp"
+#include "Independent/Math/TransformCodec.hpp"
 #include "Independent/Math/Vector.hpp"
 #include "Independent/ComponentRegistry.hpp"
 #include "Independent/ECS/GameObject.hpp"
@@ -26,12 +27,17 @@ namespace Blaster::Independent::Math
 
     public:
 
+        static constexpr bool TracksDescribedFields = true;
+        static constexpr bool VersionsDescribedFields = true;
+
         void Translate(const Vector<float, 3>& translation)
         {
             auto lastLocalPosition = localPosition;
 
             localPosition += translation;
 
+            BumpFieldVersion();
+
             for (auto& function : onPositionUpdated)
                 function(localPosition);
         }
@@ -40,6 +46,8 @@ namespace Blaster::Independent::Math
         {
             localRotation += rotationDeg;
 
+            BumpFieldVersion();
+
             for (int i = 0; i < 3; ++i)
             {
                 localRotation[i] = std::fmod(localRotation[i], 360.0f);
@@ -56,6 +64,8 @@ namespace Blaster::Independent::Math
         {
             localScale += scale;
 
+            BumpFieldVersion();
+
             for (auto& function : onScaleUpdated)
                 function(localScale);
         }
@@ -72,6 +82,8 @@ namespace Blaster::Independent::Math
 
             localPosition = value;
 
+            BumpFieldVersion();
+
             if (!update)
                 return;
 
@@ -89,6 +101,8 @@ namespace Blaster::Independent::Math
         {
             localRotation = value;
 
+            BumpFieldVersion();
+
             for (int i = 0; i < 3; ++i)
             {
                 localRotation[i] = std::fmod(localRotation[i], 360.0f);
@@ -114,6 +128,8 @@ namespace Blaster::Independent::Math
         {
             localScale = value;
 
+            BumpFieldVersion();
+
             if (!update)
                 return;
 
@@ -229,37 +245,62 @@ namespace Blaster::Independent::Math
             onScaleUpdated.push_back(function);
         }
 
+        [[nodiscard]]
+        Vector<float, 3> GetLinearVelocity() const
+        {
+            return linearVelocity;
+        }
+
+        [[nodiscard]]
+        Vector<float, 3> GetAngularVelocity() const
+        {
+            return angularVelocity;
+        }
+
         void Update() override
         {
             using Clock = std::chrono::steady_clock;
 
+            const Clock::time_point now = Clock::now();
+
             {
-                const bool positionChanged = (localPosition != lastSyncedPosition);
+                const float elapsed = std::chrono::duration<float>(now - lastSampleTime).count();
 
-                if (positionChanged)
-                    pendingSync = true;
+                if (elapsed > 0.0f)
+                {
+                    measuredLinearVelocity = (localPosition - lastSyncedPosition) / elapsed;
+                    measuredAngularVelocity = WrapAngles(localRotation - lastSyncedRotation) / elapsed;
+                }
 
                 lastSyncedPosition = localPosition;
+                lastSyncedRotation = localRotation;
+                lastSampleTime = now;
             }
 
-            {
-                const bool rotationChanged = (localRotation != lastSyncedRotation);
+            if (now - lastSentTime < kSyncPeriod)
+                return;
 
-                if (rotationChanged)
-                    pendingSync = true;
+            const float sinceSent = std::chrono::duration<float>(now - lastSentTime).count();
 
-                lastSyncedRotation = localRotation;
-            }
+            const Vector<float, 3> predictedPosition = sentPosition + linearVelocity * sinceSent;
+            const Vector<float, 3> predictedRotation = sentRotation + angularVelocity * sinceSent;
 
-            if (!pendingSync)
+            const bool positionDiverged = Vector<float, 3>::Magnitude(localPosition - predictedPosition) > kPositionThreshold;
+            const bool rotationDiverged = MaximumComponent(WrapAngles(localRotation - predictedRotation)) > kAngleThreshold;
+
+            const bool atRest = localPosition == sentPosition && localRotation == sentRotation && linearVelocity == Vector<float, 3>{ 0.0f, 0.0f, 0.0f } && angularVelocity == Vector<float, 3>{ 0.0f, 0.0f, 0.0f };
+            const bool keepalive = !atRest && now - lastSentTime >= kMaximumSilence;
+
+            if (!positionDiverged && !rotationDiverged && !keepalive)
                 return;
 
-            pendingSync = false;
+            sentPosition = localPosition;
+            sentRotation = localRotation;
 
-            const Clock::time_point now = Clock::now();
+            linearVelocity = Vector<float, 3>::Magnitude(measuredLinearVelocity) > kRestSpeed ? measuredLinearVelocity : Vector<float, 3>{ 0.0f, 0.0f, 0.0f };
+            angularVelocity = MaximumComponent(measuredAngularVelocity) > kRestSpeed ? measuredAngularVelocity : Vector<float, 3>{ 0.0f, 0.0f, 0.0f };
 
-            if (now - lastSentTime < kSyncPeriod)
-                return;
+            BumpFieldVersion();
 
             lastSentTime = now;
 
@@ -278,6 +319,8 @@ namespace Blaster::Independent::Math
                 parent = std::nullopt;
             else
                 parent = std::make_optional<std::weak_ptr<Transform3d>>(newParent);
+
+            BumpFieldVersion();
         }
 
         [[nodiscard]]
@@ -300,6 +343,65 @@ namespace Blaster::Independent::Math
             return localMatrix;
         }
 
+        static std::vector<std::uint8_t> EncodeTrackedFields(const Transform3d& transform, const std::uint64_t mask)
+        {
+            BitWriter writer;
+
+            if (mask & DescribedFieldBit<Transform3d, &Transform3d::localPosition>())
+                TransformCodec::WritePosition(writer, transform.localPosition);
+
+            if (mask & DescribedFieldBit<Transform3d, &Transform3d::localRotation>())
+                TransformCodec::WriteRotation(writer, transform.localRotation);
+
+            if (mask & DescribedFieldBit<Transform3d, &Transform3d::localScale>())
+                TransformCodec::WriteScale(writer, transform.localScale);
+
+            if (mask & DescribedFieldBit<Transform3d, &Transform3d::linearVelocity>())
+                TransformCodec::WriteLinearVelocity(writer, transform.linearVelocity);
+
+            if (mask & DescribedFieldBit<Transform3d, &Transform3d::angularVelocity>())
+                TransformCodec::WriteAngularVelocity(writer, transform.angularVelocity);
+
+            return writer.Finish();
+        }
+
+        static bool ApplyTrackedFields(Transform3d& transform, const std::uint64_t mask, const std::span<const std::uint8_t> blob)
+        {
+            BitReader reader(blob);
+
+            Vector<float, 3> position = transform.localPosition;
+            Vector<float, 3> rotation = transform.localRotation;
+            Vector<float, 3> scale = transform.localScale;
+            Vector<float, 3> linear = transform.linearVelocity;
+            Vector<float, 3> angular = transform.angularVelocity;
+
+            if (mask & DescribedFieldBit<Transform3d, &Transform3d::localPosition>())
+                position = TransformCodec::ReadPosition(reader);
+
+            if (mask & DescribedFieldBit<Transform3d, &Transform3d::localRotation>())
+                rotation = TransformCodec::ReadRotation(reader);
+
+            if (mask & DescribedFieldBit<Transform3d, &Transform3d::localScale>())
+                scale = TransformCodec::ReadScale(reader);
+
+            if (mask & DescribedFieldBit<Transform3d, &Transform3d::linearVelocity>())
+                linear = TransformCodec::ReadLinearVelocity(reader);
+
+            if (mask & DescribedFieldBit<Transform3d, &Transform3d::angularVelocity>())
+                angular = TransformCodec::ReadAngularVelocity(reader);
+
+            if (reader.IsOverflowed())
+                return false;
+
+            transform.localPosition = position;
+            transform.localRotation = rotation;
+            transform.localScale = scale;
+            transform.linearVelocity = linear;
+            transform.angularVelocity = angular;
+
+            return true;
+        }
+
         static std::shared_ptr<Transform3d> Create(const Vector<float, 3>& position, const Vector<float, 3>& rotation, const Vector<float, 3>& scale)
         {
             std::shared_ptr<Transform3d> result(new Transform3d());
@@ -315,6 +417,19 @@ namespace Blaster::Independent::Math
 
         Transform3d() = default;
 
+        static Vector<float, 3> WrapAngles(Vector<float, 3> angles)
+        {
+            for (int i = 0; i < 3; ++i)
+                angles[i] = std::remainder(angles[i], 360.0f);
+
+            return angles;
+        }
+
+        static float MaximumComponent(const Vector<float, 3>& value)
+        {
+            return std::max({ std::fabs(value.x()), std::fabs(value.y()), std::fabs(value.z()) });
+        }
+
         friend class boost::serialization::access;
         friend class Blaster::Independent::ECS::ComponentFactory;
 
@@ -326,6 +441,11 @@ namespace Blaster::Independent::Math
             archive & BOOST_SERIALIZATION_NVP(localPosition);
             archive & BOOST_SERIALIZATION_NVP(localRotation);
             archive & BOOST_SERIALIZATION_NVP(localScale);
+            archive & BOOST_SERIALIZATION_NVP(linearVelocity);
+            archive & BOOST_SERIALIZATION_NVP(angularVelocity);
+
+            if constexpr (Archive::is_loading::value)
+                BumpFieldVersion();
         }
 
         std::optional<std::weak_ptr<Transform3d>> parent;
@@ -338,15 +458,28 @@ namespace Blaster::Independent::Math
         Vector<float, 3> localRotation = { 0.0f, 0.0f, 0.0f };
         Vector<float, 3> localScale = { 1.0f, 1.0f, 1.0f };
 
+        Vector<float, 3> linearVelocity = { 0.0f, 0.0f, 0.0f };
+        Vector<float, 3> angularVelocity = { 0.0f, 0.0f, 0.0f };
+
         Vector<float, 3> lastSyncedPosition = localPosition;
         Vector<float, 3> lastSyncedRotation = localRotation;
+        std::chrono::steady_clock::time_point lastSampleTime = std::chrono::steady_clock::now();
+
+        Vector<float, 3> measuredLinearVelocity = { 0.0f, 0.0f, 0.0f };
+        Vector<float, 3> measuredAngularVelocity = { 0.0f, 0.0f, 0.0f };
 
-        bool pendingSync = false;
+        Vector<float, 3> sentPosition = localPosition;
+        Vector<float, 3> sentRotation = localRotation;
         std::chrono::steady_clock::time_point lastSentTime = std::chrono::steady_clock::now();
 
         inline static constexpr std::chrono::milliseconds kSyncPeriod{ 100 };
+        inline static constexpr std::chrono::milliseconds kMaximumSilence{ 1000 };
+
+        inline static constexpr float kPositionThreshold = 0.05f;
+        inline static constexpr float kAngleThreshold = 2.0f;
+        inline static constexpr float kRestSpeed = 0.01f;
 
-        DESCRIBE_AND_REGISTER(Transform3d, (Component), (), (), (parent, localPosition, localRotation, localScale))
+        DESCRIBE_AND_REGISTER(Transform3d, (Component), (), (), (parent, localPosition, localRotation, localScale, linearVelocity, angularVelocity))
     };
 }
 
@@ -0,0 +1,222 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include "Independent/Math/Vector.hpp"
+#include "Independent/Network/BitStream.hpp"
+
+using namespace Blaster::Independent::Network;
+
+namespace Blaster::Independent::Math
+{
+    struct QuantizedRange
+    {
+        float minimum;
+        float maximum;
+        float precision;
+
+        [[nodiscard]]
+        std::uint32_t GetBitCount() const
+        {
+            return static_cast<std::uint32_t>(std::bit_width(GetMaximumStep()));
+        }
+
+        [[nodiscard]]
+        std::uint32_t GetMaximumStep() const
+        {
+            return static_cast<std::uint32_t>(std::ceil((maximum - minimum) / precision));
+        }
+
+        [[nodiscard]]
+        bool Contains(const Vector<float, 3>& value) const
+        {
+            for (int i = 0; i < 3; ++i)
+            {
+                if (!(value[i] >= minimum && value[i] <= maximum))
+                    return false;
+            }
+
+            return true;
+        }
+    };
+
+    class TransformCodec final
+    {
+
+    public:
+
+        TransformCodec(const TransformCodec&) = delete;
+        TransformCodec(TransformCodec&&) = delete;
+        TransformCodec& operator=(const TransformCodec&) = delete;
+        TransformCodec& operator=(TransformCodec&&) = delete;
+
+        static void Configure(const QuantizedRange& position, const QuantizedRange& linearVelocity, const QuantizedRange& angularVelocity)
+        {
+            positionRange = position;
+            linearVelocityRange = linearVelocity;
+            angularVelocityRange = angularVelocity;
+        }
+
+        static const QuantizedRange& GetPositionRange()
+        {
+            return positionRange;
+        }
+
+        static const QuantizedRange& GetLinearVelocityRange()
+        {
+            return linearVelocityRange;
+        }
+
+        static const QuantizedRange& GetAngularVelocityRange()
+        {
+            return angularVelocityRange;
+        }
+
+        static constexpr float GetRotationStep()
+        {
+            return 360.0f / static_cast<float>(kRotationSteps);
+        }
+
+        static void WritePosition(BitWriter& writer, const Vector<float, 3>& position)
+        {
+            WriteVector(writer, positionRange, position);
+        }
+
+        static Vector<float, 3> ReadPosition(BitReader& reader)
+        {
+            return ReadVector(reader, positionRange);
+        }
+
+        static void WriteRotation(BitWriter& writer, const Vector<float, 3>& rotation)
+        {
+            for (int i = 0; i < 3; ++i)
+            {
+                float angle = std::fmod(rotation[i], 360.0f);
+
+                if (angle < 0.0f)
+                    angle += 360.0f;
+
+                writer.Write(static_cast<std::uint32_t>(std::lround(angle / 360.0f * kRotationSteps)) % kRotationSteps, kRotationBits);
+            }
+        }
+
+        static Vector<float, 3> ReadRotation(BitReader& reader)
+        {
+            Vector<float, 3> result;
+
+            for (int i = 0; i < 3; ++i)
+                result[i] = static_cast<float>(reader.Read(kRotationBits)) * 360.0f / kRotationSteps;
+
+            return result;
+        }
+
+        static void WriteScale(BitWriter& writer, const Vector<float, 3>& scale)
+        {
+            const bool unit = scale == Vector<float, 3>{ 1.0f, 1.0f, 1.0f };
+
+            writer.WriteBool(unit);
+
+            if (unit)
+                return;
+
+            for (int i = 0; i < 3; ++i)
+                writer.WriteFloat(scale[i]);
+        }
+
+        static Vector<float, 3> ReadScale(BitReader& reader)
+        {
+            if (reader.ReadBool())
+                return { 1.0f, 1.0f, 1.0f };
+
+            Vector<float, 3> result;
+
+            for (int i = 0; i < 3; ++i)
+                result[i] = reader.ReadFloat();
+
+            return result;
+        }
+
+        static void WriteLinearVelocity(BitWriter& writer, const Vector<float, 3>& velocity)
+        {
+            WriteVelocity(writer, linearVelocityRange, velocity);
+        }
+
+        static Vector<float, 3> ReadLinearVelocity(BitReader& reader)
+        {
+            return ReadVelocity(reader, linearVelocityRange);
+        }
+
+        static void WriteAngularVelocity(BitWriter& writer, const Vector<float, 3>& velocity)
+        {
+            WriteVelocity(writer, angularVelocityRange, velocity);
+        }
+
+        static Vector<float, 3> ReadAngularVelocity(BitReader& reader)
+        {
+            return ReadVelocity(reader, angularVelocityRange);
+        }
+
+    private:
+
+        TransformCodec() = default;
+
+        static void WriteVelocity(BitWriter& writer, const QuantizedRange& range, const Vector<float, 3>& velocity)
+        {
+            const bool zero = velocity == Vector<float, 3>{ 0.0f, 0.0f, 0.0f };
+
+            writer.WriteBool(zero);
+
+            if (!zero)
+                WriteVector(writer, range, velocity);
+        }
+
+        static Vector<float, 3> ReadVelocity(BitReader& reader, const QuantizedRange& range)
+        {
+            if (reader.ReadBool())
+                return { 0.0f, 0.0f, 0.0f };
+
+            return ReadVector(reader, range);
+        }
+
+        static void WriteVector(BitWriter& writer, const QuantizedRange& range, const Vector<float, 3>& value)
+        {
+            const bool quantized = range.Contains(value);
+
+            writer.WriteBool(quantized);
+
+            for (int i = 0; i < 3; ++i)
+            {
+                if (quantized)
+                    writer.Write(std::min(static_cast<std::uint32_t>(std::lround((value[i] - range.minimum) / range.precision)), range.GetMaximumStep()), range.GetBitCount());
+                else
+                    writer.WriteFloat(value[i]);
+            }
+        }
+
+        static Vector<float, 3> ReadVector(BitReader& reader, const QuantizedRange& range)
+        {
+            const bool quantized = reader.ReadBool();
+
+            Vector<float, 3> result;
+
+            for (int i = 0; i < 3; ++i)
+            {
+                if (quantized)
+                    result[i] = range.minimum + static_cast<float>(reader.Read(range.GetBitCount())) * range.precision;
+                else
+                    result[i] = reader.ReadFloat();
+            }
+
+            return result;
+        }
+
+        inline static QuantizedRange positionRange{ -4096.0f, 4096.0f, 1.0f / 1024.0f };
+        inline static QuantizedRange linearVelocityRange{ -256.0f, 256.0f, 1.0f / 256.0f };
+        inline static QuantizedRange angularVelocityRange{ -1440.0f, 1440.0f, 1.0f / 16.0f };
+
+        inline static constexpr std::uint32_t kRotationBits = 16;
+        inline static constexpr std::uint32_t kRotationSteps = 1u << kRotationBits;
+
+    };
+}
\ No newline at end of file
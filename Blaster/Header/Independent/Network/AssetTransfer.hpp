@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Independent/Network/CommonNetwork.hpp"
+#include "Independent/Utility/AssetCache.hpp"
+
+namespace Blaster::Independent::Network
+{
+    struct AssetRequest
+    {
+        Utility::AssetHash hash;
+    };
+
+    struct AssetData
+    {
+        Utility::AssetHash hash;
+        std::vector<std::uint8_t> bytes;
+    };
+}
+
+template <>
+struct Blaster::Independent::Network::DataConversion<Blaster::Independent::Network::AssetRequest> : Blaster::Independent::Network::DataConversionBase<Blaster::Independent::Network::DataConversion<Blaster::Independent::Network::AssetRequest>, Blaster::Independent::Network::AssetRequest>
+{
+    using Type = Blaster::Independent::Network::AssetRequest;
+
+    static void Encode(const Type& value, std::vector<std::uint8_t>& buffer)
+    {
+        CommonNetwork::WriteTrivial(buffer, value.hash);
+    }
+
+    static std::any Decode(std::span<const std::uint8_t> bytes)
+    {
+        std::size_t offset = 0;
+
+        Type result = {};
+
+        result.hash = CommonNetwork::ReadTrivial<Blaster::Independent::Utility::AssetHash>(bytes, offset);
+
+        return result;
+    }
+};
+
+template <>
+struct Blaster::Independent::Network::DataConversion<Blaster::Independent::Network::AssetData> : Blaster::Independent::Network::DataConversionBase<Blaster::Independent::Network::DataConversion<Blaster::Independent::Network::AssetData>, Blaster::Independent::Network::AssetData>
+{
+    using Type = Blaster::Independent::Network::AssetData;
+
+    static void Encode(const Type& value, std::vector<std::uint8_t>& buffer)
+    {
+        CommonNetwork::WriteTrivial(buffer, value.hash);
+        CommonNetwork::EncodeBlob(buffer, value.bytes);
+    }
+
+    static std::any Decode(std::span<const std::uint8_t> bytes)
+    {
+        std::size_t offset = 0;
+
+        Type result = {};
+
+        result.hash = CommonNetwork::ReadTrivial<Blaster::Independent::Utility::AssetHash>(bytes, offset);
+        result.bytes = CommonNetwork::DecodeBlob(bytes, offset);
+
+        return result;
+    }
+};
\ No newline at end of file
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Blaster::Independent::Network
+{
+    class BitWriter final
+    {
+
+    public:
+
+        void Write(const std::uint32_t value, const std::uint32_t bitCount)
+        {
+            assert(bitCount <= 32);
+
+            scratch |= (static_cast<std::uint64_t>(value) & Mask(bitCount)) << scratchBits;
+            scratchBits += bitCount;
+
+            while (scratchBits >= 8)
+            {
+                bytes.push_back(static_cast<std::uint8_t>(scratch & 0xFF));
+
+                scratch >>= 8;
+                scratchBits -= 8;
+            }
+        }
+
+        void WriteBool(const bool value)
+        {
+            Write(value ? 1 : 0, 1);
+        }
+
+        void WriteFloat(const float value)
+        {
+            Write(std::bit_cast<std::uint32_t>(value), 32);
+        }
+
+        [[nodiscard]]
+        std::size_t GetBitCount() const
+        {
+            return bytes.size() * 8 + scratchBits;
+        }
+
+        std::vector<std::uint8_t> Finish()
+        {
+            if (scratchBits > 0)
+                bytes.push_back(static_cast<std::uint8_t>(scratch & 0xFF));
+
+            scratch = 0;
+            scratchBits = 0;
+
+            return std::move(bytes);
+        }
+
+    private:
+
+        static std::uint64_t Mask(const std::uint32_t bitCount)
+        {
+            return (std::uint64_t{ 1 } << bitCount) - 1;
+        }
+
+        std::vector<std::uint8_t> bytes;
+
+        std::uint64_t scratch{ 0 };
+        std::uint32_t scratchBits{ 0 };
+
+    };
+
+    class BitReader final
+    {
+
+    public:
+
+        explicit BitReader(const std::span<const std::uint8_t> bytes) : bytes(bytes) { }
+
+        std::uint32_t Read(const std::uint32_t bitCount)
+        {
+            assert(bitCount <= 32);
+
+            while (scratchBits < bitCount)
+            {
+                if (offset >= bytes.size())
+                {
+                    overflowed = true;
+                    return 0;
+                }
+
+                scratch |= static_cast<std::uint64_t>(bytes[offset++]) << scratchBits;
+                scratchBits += 8;
+            }
+
+            const std::uint32_t result = static_cast<std::uint32_t>(scratch & ((std::uint64_t{ 1 } << bitCount) - 1));
+
+            scratch >>= bitCount;
+            scratchBits -= bitCount;
+
+            return result;
+        }
+
+        bool ReadBool()
+        {
+            return Read(1) != 0;
+        }
+
+        float ReadFloat()
+        {
+            return std::bit_cast<float>(Read(32));
+        }
+
+        [[nodiscard]]
+        bool IsOverflowed() const
+        {
+            return overflowed;
+        }
+
+    private:
+
+        std::span<const std::uint8_t> bytes;
+        std::size_t offset{ 0 };
+
+        std::uint64_t scratch{ 0 };
+        std::uint32_t scratchBits{ 0 };
+
+        bool overflowed{ false };
+
+    };
+}
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include <boost/asio.hpp>
 #include <boost/archive/text_oarchive.hpp>
+#include <boost/archive/text_iarchive.hpp>
 #include <span>
 #include <vector>
 #include "Independent/Utility/TypeRegistrar.hpp"
@@ -23,7 +24,21 @@ namespace Blaster::Independent::Network
         C2S_Rigidbody_Impulse = 7,
         C2S_Rigidbody_SetVelocity = 8,
         C2S_Rigidbody_SetTransform = 9,
-        C2S_CharacterController_Input
+        C2S_CharacterController_Input,
+        S2C_SessionTicket,
+        C2S_ResumeSession,
+        S2C_ResumeRejected,
+        S2S_EntityHandoff,
+        S2S_HandoffAccepted,
+        S2C_ZoneRedirect,
+        C2S_ClaimHandoff,
+        C2S_RelayHello,
+        S2C_WorldChunk,
+        C2S_AssetRequest,
+        S2C_AssetRequest,
+        C2S_AssetData,
+        S2C_AssetData,
+        C2S_BaselineMiss
     };
 
     struct PacketHeader
@@ -246,6 +261,19 @@ namespace Blaster::Independent::Network
             return { txt.begin(), txt.end() };
         }
 
+        template <typename PtrT>
+        static PtrT DeserializePointerFromBlob(std::span<const std::uint8_t> blob)
+        {
+            std::istringstream stream(std::string(blob.begin(), blob.end()));
+            boost::archive::text_iarchive archive(stream);
+
+            PtrT result;
+
+            archive >> result;
+
+            return result;
+        }
+
     private:
 
         CommonNetwork() = default;
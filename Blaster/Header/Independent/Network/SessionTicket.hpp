@@ -0,0 +1,69 @@
+#pragma once
+
+#include "Independent/Network/CommonNetwork.hpp"
+
+namespace Blaster::Independent::Network
+{
+    struct SessionTicket
+    {
+        NetworkId id;
+        std::uint64_t token;
+    };
+
+    struct ResumeRequest
+    {
+        NetworkId id;
+        std::uint64_t token;
+        std::uint64_t lastSequence;
+    };
+}
+
+template <>
+struct Blaster::Independent::Network::DataConversion<Blaster::Independent::Network::SessionTicket> : Blaster::Independent::Network::DataConversionBase<Blaster::Independent::Network::DataConversion<Blaster::Independent::Network::SessionTicket>, Blaster::Independent::Network::SessionTicket>
+{
+    using Type = Blaster::Independent::Network::SessionTicket;
+
+    static void Encode(const Type& value, std::vector<std::uint8_t>& buffer)
+    {
+        CommonNetwork::WriteTrivial(buffer, value.id);
+        CommonNetwork::WriteTrivial(buffer, value.token);
+    }
+
+    static std::any Decode(std::span<const std::uint8_t> bytes)
+    {
+        std::size_t offset = 0;
+
+        Type result = {};
+
+        result.id = CommonNetwork::ReadTrivial<NetworkId>(bytes, offset);
+        result.token = CommonNetwork::ReadTrivial<std::uint64_t>(bytes, offset);
+
+        return result;
+    }
+};
+
+template <>
+struct Blaster::Independent::Network::DataConversion<Blaster::Independent::Network::ResumeRequest> : Blaster::Independent::Network::DataConversionBase<Blaster::Independent::Network::DataConversion<Blaster::Independent::Network::ResumeRequest>, Blaster::Independent::Network::ResumeRequest>
+{
+    using Type = Blaster::Independent::Network::ResumeRequest;
+
+    static void Encode(const Type& value, std::vector<std::uint8_t>& buffer)
+    {
+        CommonNetwork::WriteTrivial(buffer, value.id);
+        CommonNetwork::WriteTrivial(buffer, value.token);
+        CommonNetwork::WriteTrivial(buffer, value.lastSequence);
+    }
+
+    static std::any Decode(std::span<const std::uint8_t> bytes)
+    {
+        std::size_t offset = 0;
+
+        Type result = {};
+
+        result.id = CommonNetwork::ReadTrivial<NetworkId>(bytes, offset);
+        result.token = CommonNetwork::ReadTrivial<std::uint64_t>(bytes, offset);
+        result.lastSequence = CommonNetwork::ReadTrivial<std::uint64_t>(bytes, offset);
+
+        return result;
+    }
+};
\ No newline at end of file
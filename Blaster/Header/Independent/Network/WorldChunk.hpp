@@ -0,0 +1,114 @@
+#pragma once
+
+#include <optional>
+#include <zstd.h>
+#include "Independent/Network/CommonNetwork.hpp"
+
+namespace Blaster::Independent::Network
+{
+    enum class WorldChunkFlag : std::uint8_t
+    {
+        None = 0,
+        Essential = 1 << 0,
+        Final = 1 << 1
+    };
+
+    struct WorldChunk
+    {
+        std::uint32_t index;
+        std::uint8_t flags;
+        std::uint32_t rawSize;
+        std::vector<std::uint8_t> compressed;
+
+        [[nodiscard]]
+        bool HasFlag(const WorldChunkFlag flag) const
+        {
+            return (flags & static_cast<std::uint8_t>(flag)) != 0;
+        }
+    };
+
+    class WorldChunkCodec final
+    {
+
+    public:
+
+        WorldChunkCodec(const WorldChunkCodec&) = delete;
+        WorldChunkCodec(WorldChunkCodec&&) = delete;
+        WorldChunkCodec& operator=(const WorldChunkCodec&) = delete;
+        WorldChunkCodec& operator=(WorldChunkCodec&&) = delete;
+
+        static WorldChunk Compress(const std::uint32_t index, const std::uint8_t flags, const std::span<const std::uint8_t> payload)
+        {
+            WorldChunk result{ index, flags, static_cast<std::uint32_t>(payload.size()), std::vector<std::uint8_t>(ZSTD_compressBound(payload.size())) };
+
+            const std::size_t written = ZSTD_compress(result.compressed.data(), result.compressed.size(), payload.data(), payload.size(), kCompressionLevel);
+
+            if (ZSTD_isError(written))
+            {
+                result.compressed.assign(payload.begin(), payload.end());
+                result.flags |= kStoredFlag;
+
+                return result;
+            }
+
+            result.compressed.resize(written);
+
+            return result;
+        }
+
+        static std::optional<std::vector<std::uint8_t>> Decompress(const WorldChunk& chunk)
+        {
+            if (chunk.rawSize > kMaximumRawSize)
+                return std::nullopt;
+
+            if ((chunk.flags & kStoredFlag) != 0)
+                return chunk.compressed.size() == chunk.rawSize ? std::make_optional(chunk.compressed) : std::nullopt;
+
+            std::vector<std::uint8_t> result(chunk.rawSize);
+
+            const std::size_t read = ZSTD_decompress(result.data(), result.size(), chunk.compressed.data(), chunk.compressed.size());
+
+            if (ZSTD_isError(read) || read != chunk.rawSize)
+                return std::nullopt;
+
+            return result;
+        }
+
+    private:
+
+        WorldChunkCodec() = default;
+
+        static constexpr int kCompressionLevel = 3;
+        static constexpr std::uint8_t kStoredFlag = 1 << 7;
+        static constexpr std::uint32_t kMaximumRawSize = 64 * 1024 * 1024;
+
+    };
+}
+
+template <>
+struct Blaster::Independent::Network::DataConversion<Blaster::Independent::Network::WorldChunk> : Blaster::Independent::Network::DataConversionBase<Blaster::Independent::Network::DataConversion<Blaster::Independent::Network::WorldChunk>, Blaster::Independent::Network::WorldChunk>
+{
+    using Type = Blaster::Independent::Network::WorldChunk;
+
+    static void Encode(const Type& value, std::vector<std::uint8_t>& buffer)
+    {
+        CommonNetwork::WriteTrivial(buffer, value.index);
+        CommonNetwork::WriteTrivial(buffer, value.flags);
+        CommonNetwork::WriteTrivial(buffer, value.rawSize);
+        CommonNetwork::EncodeBlob(buffer, value.compressed);
+    }
+
+    static std::any Decode(std::span<const std::uint8_t> bytes)
+    {
+        std::size_t offset = 0;
+
+        Type result = {};
+
+        result.index = CommonNetwork::ReadTrivial<std::uint32_t>(bytes, offset);
+        result.flags = CommonNetwork::ReadTrivial<std::uint8_t>(bytes, offset);
+        result.rawSize = CommonNetwork::ReadTrivial<std::uint32_t>(bytes, offset);
+        result.compressed = CommonNetwork::DecodeBlob(bytes, offset);
+
+        return result;
+    }
+};
\ No newline at end of file
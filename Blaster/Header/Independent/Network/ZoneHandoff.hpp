@@ -0,0 +1,109 @@
+#pragma once
+
+#include "Independent/Network/CommonNetwork.hpp"
+
+namespace Blaster::Independent::Network
+{
+    struct EntityHandoff
+    {
+        std::uint64_t token;
+        std::string path;
+        std::string stringId;
+        bool hasOwner;
+
+        std::uint32_t operationCount;
+        std::vector<std::uint8_t> operationBlob;
+    };
+
+    struct HandoffToken
+    {
+        std::uint64_t token;
+    };
+
+    struct ZoneRedirect
+    {
+        std::string host;
+        std::uint16_t port;
+        std::uint64_t token;
+    };
+}
+
+template <>
+struct Blaster::Independent::Network::DataConversion<Blaster::Independent::Network::EntityHandoff> : Blaster::Independent::Network::DataConversionBase<Blaster::Independent::Network::DataConversion<Blaster::Independent::Network::EntityHandoff>, Blaster::Independent::Network::EntityHandoff>
+{
+    using Type = Blaster::Independent::Network::EntityHandoff;
+
+    static void Encode(const Type& value, std::vector<std::uint8_t>& buffer)
+    {
+        CommonNetwork::WriteTrivial(buffer, value.token);
+        CommonNetwork::EncodeString(buffer, value.path);
+        CommonNetwork::EncodeString(buffer, value.stringId);
+        CommonNetwork::WriteTrivial(buffer, static_cast<std::uint8_t>(value.hasOwner));
+        CommonNetwork::WriteTrivial(buffer, value.operationCount);
+        CommonNetwork::EncodeBlob(buffer, value.operationBlob);
+    }
+
+    static std::any Decode(std::span<const std::uint8_t> bytes)
+    {
+        std::size_t offset = 0;
+
+        Type result = {};
+
+        result.token = CommonNetwork::ReadTrivial<std::uint64_t>(bytes, offset);
+        result.path = CommonNetwork::DecodeString(bytes, offset);
+        result.stringId = CommonNetwork::DecodeString(bytes, offset);
+        result.hasOwner = CommonNetwork::ReadTrivial<std::uint8_t>(bytes, offset) != 0;
+        result.operationCount = CommonNetwork::ReadTrivial<std::uint32_t>(bytes, offset);
+        result.operationBlob = CommonNetwork::DecodeBlob(bytes, offset);
+
+        return result;
+    }
+};
+
+template <>
+struct Blaster::Independent::Network::DataConversion<Blaster::Independent::Network::HandoffToken> : Blaster::Independent::Network::DataConversionBase<Blaster::Independent::Network::DataConversion<Blaster::Independent::Network::HandoffToken>, Blaster::Independent::Network::HandoffToken>
+{
+    using Type = Blaster::Independent::Network::HandoffToken;
+
+    static void Encode(const Type& value, std::vector<std::uint8_t>& buffer)
+    {
+        CommonNetwork::WriteTrivial(buffer, value.token);
+    }
+
+    static std::any Decode(std::span<const std::uint8_t> bytes)
+    {
+        std::size_t offset = 0;
+
+        Type result = {};
+
+        result.token = CommonNetwork::ReadTrivial<std::uint64_t>(bytes, offset);
+
+        return result;
+    }
+};
+
+template <>
+struct Blaster::Independent::Network::DataConversion<Blaster::Independent::Network::ZoneRedirect> : Blaster::Independent::Network::DataConversionBase<Blaster::Independent::Network::DataConversion<Blaster::Independent::Network::ZoneRedirect>, Blaster::Independent::Network::ZoneRedirect>
+{
+    using Type = Blaster::Independent::Network::ZoneRedirect;
+
+    static void Encode(const Type& value, std::vector<std::uint8_t>& buffer)
+    {
+        CommonNetwork::EncodeString(buffer, value.host);
+        CommonNetwork::WriteTrivial(buffer, value.port);
+        CommonNetwork::WriteTrivial(buffer, value.token);
+    }
+
+    static std::any Decode(std::span<const std::uint8_t> bytes)
+    {
+        std::size_t offset = 0;
+
+        Type result = {};
+
+        result.host = CommonNetwork::DecodeString(bytes, offset);
+        result.port = CommonNetwork::ReadTrivial<std::uint16_t>(bytes, offset);
+        result.token = CommonNetwork::ReadTrivial<std::uint64_t>(bytes, offset);
+
+        return result;
+    }
+};
\ No newline at end of file
@@ -1,9 +1,16 @@
 #pragma once
 
+#include <cstring>
+#include <boost/serialization/array.hpp>
 #include "Independent/Math/Vector.hpp"
 #include "Independent/Physics/Collider.hpp"
+#include "Independent/Physics/Rigidbody.hpp"
+#include "Independent/Thread/MainThreadExecutor.hpp"
+#include "Independent/Utility/AssetCache.hpp"
 
 using namespace Blaster::Independent::Math;
+using namespace Blaster::Independent::Thread;
+using namespace Blaster::Independent::Utility;
 
 namespace Blaster::Independent::Physics::Colliders
 {
@@ -14,24 +21,18 @@ namespace Blaster::Independent::Physics::Colliders
 
         void Initialize() override
         {
-            auto* triangleMesh = new btTriangleMesh();
-
-            for (std::size_t i = 0; i < indices.size(); i += 3)
-            {
-                const auto& first = vertices[indices[i]];
-                const auto& second = vertices[indices[i + 1]];
-                const auto& third = vertices[indices[i + 2]];
+            ResolveGeometry();
 
-                triangleMesh->addTriangle(btVector3(first.x(), first.y(), first.z()),
-                    btVector3(second.x(), second.y(), second.z()),
-                    btVector3(third.x(), third.y(), third.z()));
-
-                triangleMesh->addTriangle(btVector3(third.x(), third.y(), third.z()),
-                    btVector3(second.x(), second.y(), second.z()),
-                    btVector3(first.x(), first.y(), first.z()));
-            }
+            shape = BuildShape();
+        }
 
-            shape = new btBvhTriangleMeshShape(triangleMesh, true);
+        void OnAfterMerge() override
+        {
+            MainThreadExecutor::GetInstance().EnqueueTask(nullptr, [lifetime = std::weak_ptr<bool>(lifetimeToken), this]()
+                {
+                    if (!lifetime.expired() && ResolveGeometry() && shape != nullptr)
+                        ReplaceShape();
+                });
         }
 
         static std::shared_ptr<ColliderMesh> Create(const std::vector<Vector<float, 3>>& vertices, const std::vector<std::uint32_t>& indices, bool shouldSynchronize = true)
@@ -57,7 +58,7 @@ namespace Blaster::Independent::Physics::Colliders
         friend class Blaster::Independent::ECS::ComponentFactory;
 
         template <typename Archive>
-        void serialize(Archive& archive, const unsigned)
+        void save(Archive& archive, const unsigned) const
         {
             archive & boost::serialization::base_object<Component>(*this);
             
@@ -65,9 +66,194 @@ namespace Blaster::Independent::Physics::Colliders
 
             if (shouldSerialize)
             {
-                archive & BOOST_SERIALIZATION_NVP(vertices);
-                archive & BOOST_SERIALIZATION_NVP(indices);
+                const AssetHash publishedGeometryHash = PublishGeometry();
+
+                archive & boost::serialization::make_nvp("geometryHash", publishedGeometryHash);
+            }
+        }
+
+        template <typename Archive>
+        void load(Archive& archive, const unsigned)
+        {
+            archive & boost::serialization::base_object<Component>(*this);
+            
+            archive & BOOST_SERIALIZATION_NVP(shouldSerialize);
+
+            if (!shouldSerialize)
+                return;
+
+            archive & BOOST_SERIALIZATION_NVP(geometryHash);
+        }
+
+        BOOST_SERIALIZATION_SPLIT_MEMBER()
+
+        bool ResolveGeometry()
+        {
+            if (geometryHash == AssetHash{} || geometryHash == resolvedGeometryHash)
+                return false;
+
+            resolvedGeometryHash = geometryHash;
+
+            if (const auto geometry = AssetCache::GetInstance().Find(geometryHash); geometry.has_value())
+                return DecodeGeometry(geometry.value());
+
+            AssetCache::GetInstance().Require(geometryHash, [lifetime = std::weak_ptr<bool>(lifetimeToken), this, hash = geometryHash](const std::string& geometry)
+                {
+                    MainThreadExecutor::GetInstance().EnqueueTask(nullptr, [lifetime, this, hash, geometry]()
+                        {
+                            if (lifetime.expired() || hash != geometryHash || !DecodeGeometry(geometry) || shape == nullptr)
+                                return;
+
+                            ReplaceShape();
+                        });
+                });
+
+            return false;
+        }
+
+        btCollisionShape* BuildShape() const
+        {
+            if (indices.size() < 3)
+                return new btEmptyShape();
+
+            auto* triangleMesh = new btTriangleMesh();
+
+            for (std::size_t i = 0; i < indices.size(); i += 3)
+            {
+                const auto& first = vertices[indices[i]];
+                const auto& second = vertices[indices[i + 1]];
+                const auto& third = vertices[indices[i + 2]];
+
+                triangleMesh->addTriangle(btVector3(first.x(), first.y(), first.z()),
+                    btVector3(second.x(), second.y(), second.z()),
+                    btVector3(third.x(), third.y(), third.z()));
+
+                triangleMesh->addTriangle(btVector3(third.x(), third.y(), third.z()),
+                    btVector3(second.x(), second.y(), second.z()),
+                    btVector3(first.x(), first.y(), first.z()));
             }
+
+            return new btBvhTriangleMeshShape(triangleMesh, true);
+        }
+
+        void ReplaceShape()
+        {
+            btCollisionShape* previous = shape;
+
+            shape = BuildShape();
+
+            if (GetGameObject())
+            {
+                if (const auto rigidbody = GetGameObject()->GetComponent<Rigidbody>(); rigidbody.has_value() && rigidbody.value()->GetBtBody())
+                {
+                    rigidbody.value()->GetBtBody()->setCollisionShape(shape);
+
+                    PhysicsWorld::GetInstance().GetHandle()->updateSingleAabb(rigidbody.value()->GetBtBody());
+                }
+            }
+
+            delete previous;
+        }
+
+        AssetHash PublishGeometry() const
+        {
+            if (vertices.empty() || indices.empty())
+                return {};
+
+            std::string geometry = EncodeGeometry();
+
+            const AssetHash hash = AssetCache::HashBytes(geometry);
+
+            if (hash == publishedHash)
+                return hash;
+
+            publishedHash = hash;
+
+            AssetCache::GetInstance().Publish(hash, [lifetime = std::weak_ptr<bool>(lifetimeToken), this]() -> std::optional<std::string>
+                {
+                    if (lifetime.expired())
+                        return std::nullopt;
+
+                    return EncodeGeometry();
+                });
+
+            return hash;
+        }
+
+        std::string EncodeGeometry() const
+        {
+            const auto vertexCount = static_cast<std::uint32_t>(vertices.size());
+            const auto indexCount = static_cast<std::uint32_t>(indices.size());
+
+            std::string result;
+
+            result.reserve(sizeof(vertexCount) + sizeof(indexCount) + vertices.size() * sizeof(float) * 3 + indices.size() * sizeof(std::uint32_t));
+
+            result.append(reinterpret_cast<const char*>(&vertexCount), sizeof(vertexCount));
+            result.append(reinterpret_cast<const char*>(&indexCount), sizeof(indexCount));
+
+            for (const auto& vertex : vertices)
+            {
+                const float components[3] = { vertex.x(), vertex.y(), vertex.z() };
+
+                result.append(reinterpret_cast<const char*>(components), sizeof(components));
+            }
+
+            for (const std::uint32_t index : indices)
+                result.append(reinterpret_cast<const char*>(&index), sizeof(index));
+
+            return result;
+        }
+
+        bool DecodeGeometry(const std::string& geometry)
+        {
+            std::uint32_t vertexCount = 0;
+            std::uint32_t indexCount = 0;
+
+            if (geometry.size() < sizeof(vertexCount) + sizeof(indexCount))
+                return false;
+
+            std::memcpy(&vertexCount, geometry.data(), sizeof(vertexCount));
+            std::memcpy(&indexCount, geometry.data() + sizeof(vertexCount), sizeof(indexCount));
+
+            if (geometry.size() != sizeof(vertexCount) + sizeof(indexCount) + static_cast<std::size_t>(vertexCount) * sizeof(float) * 3 + static_cast<std::size_t>(indexCount) * sizeof(std::uint32_t))
+            {
+                std::cerr << "Collider geometry has an unexpected size '" << geometry.size() << "'." << std::endl;
+                return false;
+            }
+
+            const char* cursor = geometry.data() + sizeof(vertexCount) + sizeof(indexCount);
+
+            vertices.clear();
+            vertices.reserve(vertexCount);
+
+            for (std::uint32_t i = 0; i < vertexCount; ++i, cursor += sizeof(float) * 3)
+            {
+                float components[3];
+
+                std::memcpy(components, cursor, sizeof(components));
+
+                vertices.push_back(Vector<float, 3>{ components[0], components[1], components[2] });
+            }
+
+            indices.resize(indexCount);
+
+            std::memcpy(indices.data(), cursor, static_cast<std::size_t>(indexCount) * sizeof(std::uint32_t));
+
+            for (const unsigned int index : indices)
+            {
+                if (index >= vertexCount)
+                {
+                    std::cerr << "Collider geometry references vertex '" << index << "' out of '" << vertexCount << "'." << std::endl;
+
+                    vertices.clear();
+                    indices.clear();
+
+                    return false;
+                }
+            }
+
+            return true;
         }
 
         std::vector<Vector<float, 3>> vertices;
@@ -75,7 +261,14 @@ namespace Blaster::Independent::Physics::Colliders
 
         bool shouldSerialize = true;
 
-        DESCRIBE_AND_REGISTER(ColliderMesh, (Collider), (), (), ())
+        mutable AssetHash publishedHash{};
+
+        AssetHash geometryHash{};
+        AssetHash resolvedGeometryHash{};
+
+        std::shared_ptr<bool> lifetimeToken{ std::make_shared<bool>(true) };
+
+        DESCRIBE_AND_REGISTER(ColliderMesh, (Collider), (), (), (geometryHash))
     };
 }
 
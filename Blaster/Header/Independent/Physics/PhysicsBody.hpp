@@ -3,6 +3,7 @@
 #include <btBulletDynamicsCommon.h>
 #include "Independent/ECS/Component.hpp"
 #include "Independent/ECS/GameObject.hpp"
+#include "Independent/ECS/Synchronization/NetworkEntityTable.hpp"
 #include "Independent/Physics/PhysicsWorld.hpp"
 
 using namespace Blaster::Independent::ECS;
@@ -38,8 +39,14 @@ namespace Blaster::Independent::Physics
         void QueueToServer(PacketType type, Command&& command) const
         {
 #ifndef IS_SERVER
-            if (IsLocallyControlled())
-                Client::Network::ClientNetwork::GetInstance().Send(type, std::forward<Command>(command));
+            if (!IsLocallyControlled())
+                return;
+
+            std::remove_cvref_t<Command> bound = std::forward<Command>(command);
+
+            bound.entityId = Blaster::Independent::ECS::Synchronization::NetworkEntityTable::GetInstance().FindId(bound.path).value_or(0);
+
+            Client::Network::ClientNetwork::GetInstance().Send(type, std::move(bound));
 #endif
         }
 
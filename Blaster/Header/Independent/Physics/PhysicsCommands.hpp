@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Independent/ECS/Synchronization/NetworkEntityTable.hpp"
 #include "Independent/ECS/GameObject.hpp"
 #include "Independent/Math/Transform3d.hpp"
 #include "Independent/Physics/Collider.hpp"
@@ -15,6 +16,8 @@ namespace Blaster::Independent::Physics
         Vector<float, 3> impulse;
         Vector<float, 3> point;
 
+        Blaster::Independent::ECS::Synchronization::EntityId entityId{ 0 };
+
         static constexpr std::uint8_t CODE = 42;
     };
 
@@ -24,6 +27,8 @@ namespace Blaster::Independent::Physics
 
         Vector<float, 3> velocity;
 
+        Blaster::Independent::ECS::Synchronization::EntityId entityId{ 0 };
+
         static constexpr std::uint8_t CODE = 43;
     };
 
@@ -34,6 +39,8 @@ namespace Blaster::Independent::Physics
         Vector<float, 3> position;
         Vector<float, 3> rotation;
 
+        Blaster::Independent::ECS::Synchronization::EntityId entityId{ 0 };
+
         static constexpr std::uint8_t CODE = 44;
     };
 
@@ -44,6 +51,8 @@ namespace Blaster::Independent::Physics
         bool wantJump;
 
         Vector<float, 3> walkDirection;
+
+        Blaster::Independent::ECS::Synchronization::EntityId entityId{ 0 };
     };
 }
 
@@ -56,7 +65,7 @@ namespace Blaster::Independent::Network
 
         static void Encode(const Type& operation, std::vector<std::uint8_t>& buffer)
         {
-            CommonNetwork::EncodeString(buffer, operation.path);
+            Blaster::Independent::ECS::Synchronization::NetworkEntityTable::WriteReference(buffer, operation.entityId, operation.path);
             CommonNetwork::WriteTrivial(buffer, operation.hasPoint);
             DataConversion<Vector<float, 3>>::Encode(operation.impulse, buffer);
             DataConversion<Vector<float, 3>>::Encode(operation.point, buffer);
@@ -68,7 +77,7 @@ namespace Blaster::Independent::Network
 
             Type result;
 
-            result.path = CommonNetwork::DecodeString(bytes, offset);
+            result.path = Blaster::Independent::ECS::Synchronization::NetworkEntityTable::GetInstance().DecodeReference(bytes, offset).path;
             result.hasPoint = CommonNetwork::ReadTrivial<bool>(bytes, offset);
             result.impulse = std::any_cast<Vector<float, 3>>(DataConversion<Vector<float, 3>>::Decode(bytes.subspan(offset, DataConversion<Vector<float, 3>>::kWireSize)));
 
@@ -87,7 +96,7 @@ namespace Blaster::Independent::Network
 
         static void Encode(const Type& operation, std::vector<std::uint8_t>& buffer)
         {
-            CommonNetwork::EncodeString(buffer, operation.path);
+            Blaster::Independent::ECS::Synchronization::NetworkEntityTable::WriteReference(buffer, operation.entityId, operation.path);
             DataConversion<Vector<float, 3>>::Encode(operation.velocity, buffer);
         }
 
@@ -97,7 +106,7 @@ namespace Blaster::Independent::Network
 
             Type result;
 
-            result.path = CommonNetwork::DecodeString(bytes, offset);
+            result.path = Blaster::Independent::ECS::Synchronization::NetworkEntityTable::GetInstance().DecodeReference(bytes, offset).path;
             result.velocity = std::any_cast<Vector<float, 3>>(DataConversion<Vector<float, 3>>::Decode(bytes.subspan(offset, DataConversion<Vector<float, 3>>::kWireSize)));
 
             return result;
@@ -111,7 +120,7 @@ namespace Blaster::Independent::Network
 
         static void Encode(const Type& operation, std::vector<std::uint8_t>& buffer)
         {
-            CommonNetwork::EncodeString(buffer, operation.path);
+            Blaster::Independent::ECS::Synchronization::NetworkEntityTable::WriteReference(buffer, operation.entityId, operation.path);
 
             DataConversion<Vector<float, 3>>::Encode(operation.position, buffer);
             DataConversion<Vector<float, 3>>::Encode(operation.rotation, buffer);
@@ -123,7 +132,7 @@ namespace Blaster::Independent::Network
 
             Type out;
 
-            out.path = CommonNetwork::DecodeString(bytes, offset);
+            out.path = Blaster::Independent::ECS::Synchronization::NetworkEntityTable::GetInstance().DecodeReference(bytes, offset).path;
 
             out.position = std::any_cast<Vector<float, 3>>(DataConversion<Vector<float, 3>>::Decode(bytes.subspan(offset, DataConversion<Vector<float, 3>>::kWireSize)));
 
@@ -142,7 +151,7 @@ namespace Blaster::Independent::Network
 
         static void Encode(const Type& operation, std::vector<std::uint8_t>& buffer)
         {
-            CommonNetwork::EncodeString(buffer, operation.path);
+            Blaster::Independent::ECS::Synchronization::NetworkEntityTable::WriteReference(buffer, operation.entityId, operation.path);
             CommonNetwork::WriteTrivial(buffer, operation.wantJump);
             DataConversion<Vector<float, 3>>::Encode(operation.walkDirection, buffer);
         }
@@ -153,7 +162,7 @@ namespace Blaster::Independent::Network
 
             Type result;
 
-            result.path = CommonNetwork::DecodeString(bytes, offset);
+            result.path = Blaster::Independent::ECS::Synchronization::NetworkEntityTable::GetInstance().DecodeReference(bytes, offset).path;
             result.wantJump = CommonNetwork::ReadTrivial<bool>(bytes, offset);
             result.walkDirection = std::any_cast<Vector<float, 3>>(DataConversion<Vector<float, 3>>::Decode(bytes.subspan(offset, DataConversion<Vector<float, 3>>::kWireSize)));
 
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <array>
 #include <optional>
+#include "Independent/ECS/DescribedCodec.hpp"
 #include "Independent/ECS/GameObject.hpp"
 #include "Independent/Math/Transform3d.hpp"
 #include "Independent/Physics/Collider.hpp"
@@ -26,6 +28,14 @@ namespace Blaster::Independent::Physics
     {
 
     public:
+
+        static constexpr bool UsesDescribedCodec = true;
+
+        static constexpr std::array FieldAttributes
+        {
+            FieldAttribute::Quantize("linearDamping", 0.0f, 1.0f, 0.0005f),
+            FieldAttribute::Quantize("angularDamping", 0.0f, 1.0f, 0.0005f)
+        };
         
         enum class Type
         {
@@ -267,26 +277,6 @@ namespace Blaster::Independent::Physics
         friend class boost::serialization::access;
         friend class Blaster::Independent::ECS::ComponentFactory;
 
-        template <typename Archive>
-        void serialize(Archive& archive, const unsigned)
-        {
-            archive & boost::serialization::base_object<Component>(*this);
-
-            archive & BOOST_SERIALIZATION_NVP(mass);
-            archive & BOOST_SERIALIZATION_NVP(linearDamping);
-            archive & BOOST_SERIALIZATION_NVP(angularDamping);
-            archive & BOOST_SERIALIZATION_NVP(friction);
-            archive & BOOST_SERIALIZATION_NVP(colliderMargin);
-            archive & BOOST_SERIALIZATION_NVP(bodyType);
-
-            auto flags = static_cast<std::uint8_t>(lockedAxes);
-
-            archive & BOOST_SERIALIZATION_NVP(flags);
-
-            if constexpr (Archive::is_loading::value)
-                lockedAxes = static_cast<Axis>(flags);
-        }
-
         void RegisterWithWorld()
         {
             PhysicsWorld::GetInstance().AddBody(body);
@@ -379,7 +369,7 @@ namespace Blaster::Independent::Physics
         Type bodyType;
         btRigidBody* body = nullptr;
 
-        DESCRIBE_AND_REGISTER(Rigidbody, (Component), (), (), (mass, linearDamping, angularDamping, friction, colliderMargin, bodyType))
+        DESCRIBE_AND_REGISTER(Rigidbody, (Component), (), (), (mass, linearDamping, angularDamping, friction, colliderMargin, lockedAxes, bodyType))
     };
 
     inline Rigidbody::Axis operator|(Rigidbody::Axis a, Rigidbody::Axis b)
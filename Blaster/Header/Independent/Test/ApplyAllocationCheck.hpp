@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <vector>
+#include "Independent/ECS/ComponentPool.hpp"
+#include "Independent/ECS/GameObject.hpp"
+#include "Independent/ECS/Synchronization/ComponentStateCodec.hpp"
+#include "Independent/Physics/Rigidbody.hpp"
+
+#ifdef BLASTER_COUNT_ALLOCATIONS
+namespace Blaster::Independent::Test
+{
+    inline thread_local std::uint64_t allocationCount = 0;
+}
+
+void* operator new(const std::size_t size)
+{
+    ++Blaster::Independent::Test::allocationCount;
+
+    if (void* pointer = std::malloc(size == 0 ? 1 : size))
+        return pointer;
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+#endif
+
+using namespace Blaster::Independent::ECS;
+using namespace Blaster::Independent::ECS::Synchronization;
+using namespace Blaster::Independent::Math;
+using namespace Blaster::Independent::Physics;
+
+namespace Blaster::Independent::Test
+{
+    class ApplyAllocationCheck final
+    {
+
+    public:
+
+        ApplyAllocationCheck(const ApplyAllocationCheck&) = delete;
+        ApplyAllocationCheck(ApplyAllocationCheck&&) = delete;
+        ApplyAllocationCheck& operator=(const ApplyAllocationCheck&) = delete;
+        ApplyAllocationCheck& operator=(ApplyAllocationCheck&&) = delete;
+
+        static void Run()
+        {
+#ifdef BLASTER_COUNT_ALLOCATIONS
+            std::cout << "Pooled apply allocation check: " << kIterations << " full-state decodes per type." << std::endl;
+
+            Measure<Transform3d>("Transform3d (text archive)");
+            Measure<Rigidbody>("Rigidbody (binary codec)");
+#else
+            std::cout << "Pooled apply allocation check needs a build with BLASTER_COUNT_ALLOCATIONS defined; skipping." << std::endl;
+#endif
+        }
+
+    private:
+
+        ApplyAllocationCheck() = default;
+
+#ifdef BLASTER_COUNT_ALLOCATIONS
+        template <typename T>
+        static void Measure(const char* name)
+        {
+            constexpr std::uint64_t componentType = Blaster::Independent::Utility::TypeRegistrar::GetTypeId<T>();
+
+            const std::shared_ptr<Component> source = ComponentFactory::Instantiate(componentType);
+
+            if (!source)
+            {
+                std::cerr << "  " << name << ": not registered with the component factory." << std::endl;
+                return;
+            }
+
+            const std::vector<std::uint8_t> blob = ComponentStateCodec::Encode(componentType, *source);
+
+            for (std::size_t iteration = 0; iteration < kWarmupIterations; ++iteration)
+                ApplyOnce(componentType, blob);
+
+            const std::uint64_t before = allocationCount;
+
+            std::size_t failures = 0;
+
+            for (std::size_t iteration = 0; iteration < kIterations; ++iteration)
+            {
+                if (!ApplyOnce(componentType, blob))
+                    ++failures;
+            }
+
+            const std::uint64_t allocations = allocationCount - before;
+
+            std::cout << "  " << name << ": " << static_cast<double>(allocations) / static_cast<double>(kIterations) << " allocation(s) per apply, " << blob.size() << " byte blob" << (failures == 0 ? "." : ", with decode failures!") << std::endl;
+        }
+
+        static bool ApplyOnce(const std::uint64_t componentType, const std::vector<std::uint8_t>& blob)
+        {
+            std::shared_ptr<Component> pooled = ComponentPool::GetInstance().Acquire(componentType);
+
+            const bool decoded = pooled && ComponentStateCodec::DecodeInto(componentType, blob, *pooled);
+
+            ComponentPool::GetInstance().Release(componentType, std::move(pooled));
+
+            return decoded;
+        }
+#endif
+
+        static constexpr std::size_t kWarmupIterations = 16;
+        static constexpr std::size_t kIterations = 10000;
+
+    };
+}
\ No newline at end of file
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Independent/ECS/GameObject.hpp"
+#include "Independent/ECS/Synchronization/SenderSynchronization.hpp"
+
+using namespace Blaster::Independent::ECS;
+using namespace Blaster::Independent::ECS::Synchronization;
+using namespace Blaster::Independent::Math;
+
+namespace Blaster::Independent::Test
+{
+    class DirtyJournalBenchmark final
+    {
+
+    public:
+
+        DirtyJournalBenchmark(const DirtyJournalBenchmark&) = delete;
+        DirtyJournalBenchmark(DirtyJournalBenchmark&&) = delete;
+        DirtyJournalBenchmark& operator=(const DirtyJournalBenchmark&) = delete;
+        DirtyJournalBenchmark& operator=(DirtyJournalBenchmark&&) = delete;
+
+        static void Run()
+        {
+            std::cout << "Dirty journal benchmark: " << kObjectCount << " objects, " << kRounds << " round(s) per run." << std::endl;
+
+            std::vector<std::shared_ptr<GameObject>> gameObjectList;
+
+            gameObjectList.reserve(kObjectCount);
+
+            for (std::size_t i = 0; i < kObjectCount; ++i)
+            {
+                auto gameObject = GameObject::Create("dirty-benchmark-" + std::to_string(i));
+
+                gameObject->ClearJustCreated();
+                gameObject->GetTransform3d()->ClearWasAdded();
+
+                SenderSynchronization::GetInstance().RememberHash(gameObject->GetTransform3d());
+
+                gameObjectList.push_back(std::move(gameObject));
+            }
+
+            SenderSynchronization::GetInstance().FlushDirty();
+
+            for (const std::size_t threadCount : { std::size_t{ 1 }, kThreadCount })
+            {
+                std::chrono::steady_clock::duration markElapsed{};
+                std::chrono::steady_clock::duration drainElapsed{};
+
+                for (std::size_t round = 0; round < kRounds; ++round)
+                {
+                    const auto start = std::chrono::steady_clock::now();
+
+                    {
+                        std::vector<std::jthread> threadList;
+
+                        for (std::size_t thread = 0; thread < threadCount; ++thread)
+                            threadList.emplace_back([&gameObjectList]() { MarkAll(gameObjectList); });
+                    }
+
+                    const auto marked = std::chrono::steady_clock::now();
+
+                    SenderSynchronization::GetInstance().FlushDirty();
+
+                    markElapsed += marked - start;
+                    drainElapsed += std::chrono::steady_clock::now() - marked;
+                }
+
+                const double markMilliseconds = std::chrono::duration<double, std::milli>(markElapsed).count() / static_cast<double>(kRounds);
+                const double drainMilliseconds = std::chrono::duration<double, std::milli>(drainElapsed).count() / static_cast<double>(kRounds);
+
+                const double markCount = static_cast<double>(threadCount * kObjectCount * 2);
+
+                std::cout << "  " << threadCount << " thread(s): mark " << markMilliseconds << " ms (" << markCount / markMilliseconds * 1000.0 << " marks/s), drain " << drainMilliseconds << " ms per round." << std::endl;
+            }
+
+            for (const auto& gameObject : gameObjectList)
+                SenderSynchronization::GetInstance().ForgetHash(gameObject->GetTransform3d());
+        }
+
+    private:
+
+        DirtyJournalBenchmark() = default;
+
+        static void MarkAll(const std::vector<std::shared_ptr<GameObject>>& gameObjectList)
+        {
+            for (const auto& gameObject : gameObjectList)
+            {
+                SenderSynchronization::GetInstance().MarkDirty(gameObject);
+                SenderSynchronization::GetInstance().MarkDirty(gameObject, typeid(Transform3d));
+            }
+        }
+
+        static constexpr std::size_t kObjectCount = 100000;
+        static constexpr std::size_t kThreadCount = 8;
+        static constexpr std::size_t kRounds = 10;
+
+    };
+}
\ No newline at end of file
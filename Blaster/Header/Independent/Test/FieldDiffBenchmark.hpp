@@ -0,0 +1,141 @@
+#pragma once
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Client/Render/Model.hpp"
+#include "Client/Render/TextureFuture.hpp"
+#include "Independent/ECS/GameObject.hpp"
+#include "Independent/ECS/MergeSupport.hpp"
+
+using namespace Blaster::Client::Render;
+using namespace Blaster::Independent::ECS;
+using namespace Blaster::Independent::Math;
+using namespace Blaster::Independent::Utility;
+
+namespace Blaster::Independent::Test
+{
+    class FieldDiffBenchmark final
+    {
+
+    public:
+
+        FieldDiffBenchmark(const FieldDiffBenchmark&) = delete;
+        FieldDiffBenchmark(FieldDiffBenchmark&&) = delete;
+        FieldDiffBenchmark& operator=(const FieldDiffBenchmark&) = delete;
+        FieldDiffBenchmark& operator=(FieldDiffBenchmark&&) = delete;
+
+        static void Run()
+        {
+            std::cout << "Field diff benchmark: " << kComponentCount << " components, " << kChangedCount << " changed per flush, " << kRounds << " round(s) per run." << std::endl;
+
+            Measure<Transform3d>("Transform3d", [](const std::size_t index)
+                {
+                    return Transform3d::Create({ static_cast<float>(index), 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f });
+                });
+
+            Measure<TextureFuture>("TextureFuture", [](const std::size_t index)
+                {
+                    return TextureFuture::Create("field-diff-benchmark-" + std::to_string(index));
+                });
+
+            Measure<Model>("Model", [](const std::size_t index)
+                {
+                    return Model::Create({ "Blaster", "Model/FieldDiffBenchmark" + std::to_string(index) + ".fbx" }, index % 2 == 0);
+                });
+        }
+
+    private:
+
+        FieldDiffBenchmark() = default;
+
+        template <typename T, typename Factory>
+        static void Measure(const char* name, Factory&& create)
+        {
+            std::vector<std::shared_ptr<T>> componentList;
+            std::vector<std::shared_ptr<void>> shadowList(kComponentCount);
+
+            componentList.reserve(kComponentCount);
+
+            for (std::size_t i = 0; i < kComponentCount; ++i)
+                componentList.push_back(create(i));
+
+            DiffAll(componentList, shadowList);
+
+            std::size_t versionedChanged = 0;
+            std::size_t comparedChanged = 0;
+
+            std::chrono::steady_clock::duration versionedElapsed{};
+            std::chrono::steady_clock::duration comparedElapsed{};
+
+            for (std::size_t round = 0; round < kRounds; ++round)
+            {
+                ChangeSome(componentList, create, round);
+
+                const auto versionedStart = std::chrono::steady_clock::now();
+
+                versionedChanged += DiffAll(componentList, shadowList);
+
+                versionedElapsed += std::chrono::steady_clock::now() - versionedStart;
+
+                ChangeSome(componentList, create, round + kRounds);
+
+                for (const auto& component : componentList)
+                    component->BumpFieldVersion();
+
+                const auto comparedStart = std::chrono::steady_clock::now();
+
+                comparedChanged += DiffAll(componentList, shadowList);
+
+                comparedElapsed += std::chrono::steady_clock::now() - comparedStart;
+            }
+
+            const double versionedMilliseconds = std::chrono::duration<double, std::milli>(versionedElapsed).count() / static_cast<double>(kRounds);
+            const double comparedMilliseconds = std::chrono::duration<double, std::milli>(comparedElapsed).count() / static_cast<double>(kRounds);
+
+            const std::size_t blobSize = MergeSupport::EncodeFields(componentList.front(), kAllFields).value_or(std::vector<std::uint8_t>{}).size();
+
+            std::cout << "  " << name << " (" << blobSize << " byte full field blob):" << std::endl;
+            std::cout << "    version-gated: " << versionedMilliseconds << " ms per flush, " << versionedChanged / kRounds << " component(s) reported changed." << std::endl;
+            std::cout << "    full compare:  " << comparedMilliseconds << " ms per flush, " << comparedChanged / kRounds << " component(s) reported changed (" << comparedMilliseconds / versionedMilliseconds << "x)." << std::endl;
+        }
+
+        template <typename T>
+        static std::size_t DiffAll(const std::vector<std::shared_ptr<T>>& componentList, std::vector<std::shared_ptr<void>>& shadowList)
+        {
+            std::size_t changed = 0;
+
+            for (std::size_t i = 0; i < componentList.size(); ++i)
+            {
+                if (MergeSupport::DiffFields(componentList[i], shadowList[i]).value_or(0) != 0)
+                    ++changed;
+            }
+
+            return changed;
+        }
+
+        template <typename T, typename Factory>
+        static void ChangeSome(const std::vector<std::shared_ptr<T>>& componentList, Factory& create, const std::size_t round)
+        {
+            const std::size_t stride = componentList.size() / kChangedCount;
+
+            for (std::size_t i = 0; i < kChangedCount; ++i)
+            {
+                const auto& component = componentList[(i * stride + round) % componentList.size()];
+
+                const std::vector<std::uint8_t> blob = MergeSupport::EncodeFields(create(kComponentCount + i + round * kChangedCount), kAllFields).value_or(std::vector<std::uint8_t>{});
+
+                MergeSupport::ApplyFields(component, kAllFields, blob);
+            }
+        }
+
+        static constexpr std::size_t kComponentCount = 10000;
+        static constexpr std::size_t kChangedCount = kComponentCount / 100;
+        static constexpr std::size_t kRounds = 50;
+
+        static constexpr std::uint64_t kAllFields = ~std::uint64_t{ 0 };
+
+    };
+}
\ No newline at end of file
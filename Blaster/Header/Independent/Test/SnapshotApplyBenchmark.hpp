@@ -0,0 +1,131 @@
+#pragma once
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "Independent/ECS/GameObjectManager.hpp"
+#include "Independent/ECS/Synchronization/ComponentStateCodec.hpp"
+#include "Independent/ECS/Synchronization/ReceiverSynchronization.hpp"
+#include "Independent/ECS/Synchronization/SyncTracker.hpp"
+
+using namespace Blaster::Independent::ECS;
+using namespace Blaster::Independent::ECS::Synchronization;
+using namespace Blaster::Independent::Math;
+using namespace Blaster::Independent::Network;
+
+namespace Blaster::Independent::Test
+{
+    class SnapshotApplyBenchmark final
+    {
+
+    public:
+
+        SnapshotApplyBenchmark(const SnapshotApplyBenchmark&) = delete;
+        SnapshotApplyBenchmark(SnapshotApplyBenchmark&&) = delete;
+        SnapshotApplyBenchmark& operator=(const SnapshotApplyBenchmark&) = delete;
+        SnapshotApplyBenchmark& operator=(SnapshotApplyBenchmark&&) = delete;
+
+        static void Run()
+        {
+            std::cout << "Snapshot apply benchmark: " << kEntityCount << " Transform3d set-field operations per snapshot, " << kIterations << " snapshots per run." << std::endl;
+
+            for (std::size_t i = 0; i < kEntityCount; ++i)
+                GameObjectManager::GetInstance().Register(GameObject::Create(MakePath(i)));
+
+            std::uint64_t sequence = SyncTracker::GetInstance().GetLastIncoming(kOrigin);
+
+            std::chrono::steady_clock::duration inlineElapsed{};
+            std::chrono::steady_clock::duration decodeElapsed{};
+            std::chrono::steady_clock::duration applyElapsed{};
+
+            for (std::size_t iteration = 0; iteration < kIterations; ++iteration)
+            {
+                std::vector<std::uint8_t> payload = BuildPayload(++sequence);
+
+                const auto start = std::chrono::steady_clock::now();
+
+                ReceiverSynchronization::GetInstance().HandleSnapshotPayload(std::move(payload));
+
+                inlineElapsed += std::chrono::steady_clock::now() - start;
+            }
+
+            for (std::size_t iteration = 0; iteration < kIterations; ++iteration)
+            {
+                std::vector<std::uint8_t> payload = BuildPayload(++sequence);
+
+                const auto decodeStart = std::chrono::steady_clock::now();
+
+                std::optional<PreparedSnapshot> prepared = ReceiverSynchronization::GetInstance().PrepareSnapshot(std::move(payload));
+
+                const auto applyStart = std::chrono::steady_clock::now();
+
+                if (prepared.has_value())
+                    ReceiverSynchronization::GetInstance().ApplyPrepared(prepared.value());
+
+                applyElapsed += std::chrono::steady_clock::now() - applyStart;
+                decodeElapsed += applyStart - decodeStart;
+            }
+
+            std::cout << "  Main-thread time per snapshot: " << ToMilliseconds(inlineElapsed) << " ms decoding and applying inline, " << ToMilliseconds(applyElapsed) << " ms applying after an io-thread decode of " << ToMilliseconds(decodeElapsed) << " ms." << std::endl;
+
+            for (std::size_t i = 0; i < kEntityCount; ++i)
+                GameObjectManager::GetInstance().Unregister(MakePath(i));
+
+            SyncTracker::GetInstance().ForgetPeer(kOrigin);
+        }
+
+    private:
+
+        SnapshotApplyBenchmark() = default;
+
+        static std::vector<std::uint8_t> BuildPayload(const std::uint64_t sequence)
+        {
+            constexpr std::uint64_t componentType = Blaster::Independent::Utility::TypeRegistrar::GetTypeId<Transform3d>();
+
+            Snapshot snapshot{};
+
+            snapshot.header.sequence = sequence;
+            snapshot.header.operationCount = 0;
+            snapshot.header.ack = 0;
+            snapshot.header.route = Route::ToServerOnly;
+            snapshot.header.origin = kOrigin;
+            snapshot.header.tick = 0;
+
+            for (std::size_t i = 0; i < kEntityCount; ++i)
+            {
+                const auto transform = Transform3d::Create({ static_cast<float>(i), static_cast<float>(sequence), 0.0f }, { 0.0f, 45.0f, 0.0f }, { 1.0f, 1.0f, 1.0f });
+
+                std::vector<std::uint8_t> encoded;
+
+                DataConversion<OpSetField>::Encode(OpSetField{ MakePath(i), static_cast<int>(componentType), 0, ComponentStateCodec::Encode(componentType, *transform) }, encoded);
+
+                CommonNetwork::WriteTrivial(snapshot.operationBlob, static_cast<std::uint8_t>(OpSetField::Code));
+                CommonNetwork::WriteTrivial(snapshot.operationBlob, static_cast<std::uint32_t>(encoded.size()));
+                CommonNetwork::WriteRaw(snapshot.operationBlob, encoded.data(), encoded.size());
+
+                ++snapshot.header.operationCount;
+            }
+
+            const std::span<const std::uint8_t> payload = CommonNetwork::AssembleData(snapshot);
+
+            return { payload.begin(), payload.end() };
+        }
+
+        static double ToMilliseconds(const std::chrono::steady_clock::duration elapsed)
+        {
+            return std::chrono::duration<double, std::milli>(elapsed).count() / static_cast<double>(kIterations);
+        }
+
+        static std::string MakePath(const std::size_t index)
+        {
+            return "apply-benchmark-" + std::to_string(index);
+        }
+
+        static constexpr std::size_t kEntityCount = 512;
+        static constexpr std::size_t kIterations = 20;
+
+        static constexpr NetworkId kOrigin = 0x50000000;
+
+    };
+}
\ No newline at end of file
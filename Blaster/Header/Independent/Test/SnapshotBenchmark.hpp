@@ -0,0 +1,182 @@
+#pragma once
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "Independent/ECS/GameObject.hpp"
+#include "Independent/ECS/MergeSupport.hpp"
+#include "Independent/ECS/Synchronization/SenderSynchronization.hpp"
+#include "Independent/ECS/Synchronization/SyncTracker.hpp"
+#include "Independent/Thread/WorkerPool.hpp"
+
+using namespace Blaster::Independent::ECS;
+using namespace Blaster::Independent::ECS::Synchronization;
+using namespace Blaster::Independent::Math;
+using namespace Blaster::Independent::Network;
+using namespace Blaster::Independent::Thread;
+
+namespace Blaster::Independent::Test
+{
+    class SnapshotBenchmark final
+    {
+
+    public:
+
+        SnapshotBenchmark(const SnapshotBenchmark&) = delete;
+        SnapshotBenchmark(SnapshotBenchmark&&) = delete;
+        SnapshotBenchmark& operator=(const SnapshotBenchmark&) = delete;
+        SnapshotBenchmark& operator=(SnapshotBenchmark&&) = delete;
+
+        static void Run()
+        {
+            std::cout << "Snapshot benchmark: " << kEntityCount << " entities, " << kIterations << " flushes per run, " << WorkerPool::GetInstance().GetWorkerCount() << " worker thread(s)." << std::endl;
+
+            for (const std::size_t clientCount : { 16, 64, 256 })
+            {
+                const double serial = Measure(clientCount, false);
+                const double parallel = Measure(clientCount, true);
+
+                std::cout << "  " << clientCount << " clients: serial " << serial << " ms, parallel " << parallel << " ms per flush (" << serial / parallel << "x)." << std::endl;
+            }
+
+            for (std::size_t i = 0; i < kEntityCount; ++i)
+                NetworkEntityTable::GetInstance().ForgetPath(MakePath(i));
+
+            ReportFieldMaskSizes();
+        }
+
+    private:
+
+        SnapshotBenchmark() = default;
+
+        static double Measure(const std::size_t clientCount, const bool parallel)
+        {
+            std::vector<NetworkId> clientList;
+
+            for (std::size_t i = 0; i < clientCount; ++i)
+                clientList.push_back(static_cast<NetworkId>(kFirstClientId + i));
+
+            std::mt19937 generator(1234);
+
+            SenderSynchronization::GetInstance().BuildClientSnapshots(clientList, BuildTemplate(generator), parallel);
+
+            std::chrono::steady_clock::duration elapsed{};
+
+            for (std::size_t iteration = 0; iteration < kIterations; ++iteration)
+            {
+                const SnapshotTemplate snapshotTemplate = BuildTemplate(generator);
+
+                const auto start = std::chrono::steady_clock::now();
+
+                SenderSynchronization::GetInstance().BuildClientSnapshots(clientList, snapshotTemplate, parallel);
+
+                elapsed += std::chrono::steady_clock::now() - start;
+            }
+
+            for (const NetworkId id : clientList)
+            {
+                SenderSynchronization::GetInstance().ForgetClient(id);
+                SyncTracker::GetInstance().ForgetPeer(id);
+            }
+
+            return std::chrono::duration<double, std::milli>(elapsed).count() / static_cast<double>(kIterations);
+        }
+
+        static void ReportFieldMaskSizes()
+        {
+            const int componentType = static_cast<int>(Blaster::Independent::Utility::TypeRegistrar::GetTypeId<Transform3d>());
+
+            std::size_t fullBytes = 0;
+            std::size_t positionBytes = 0;
+            std::size_t everyFieldBytes = 0;
+
+            for (std::size_t i = 0; i < kEntityCount; ++i)
+            {
+                const std::string path = MakePath(i);
+
+                const EntityId entityId = NetworkEntityTable::GetInstance().Assign(path);
+
+                const auto transform = Transform3d::Create({ static_cast<float>(i), 2.0f, -3.0f }, { 0.0f, 45.0f, 0.0f }, { 1.0f, 1.0f, 1.0f });
+
+                std::shared_ptr<void> shadow;
+
+                MergeSupport::DiffFields(transform, shadow);
+
+                transform->SetLocalPosition(transform->GetLocalPosition() + Vector<float, 3>{ 0.0f, 1.0f, 0.0f }, false);
+
+                fullBytes += EncodedSize(OpSetField{ path, componentType, 0, ComponentStateCodec::Encode(static_cast<std::uint64_t>(componentType), *transform), entityId });
+                positionBytes += EncodedSize(MaskedSetField(path, entityId, componentType, transform, shadow));
+
+                transform->SetLocalPosition(transform->GetLocalPosition() + Vector<float, 3>{ 1.0f, 0.0f, 0.0f }, false);
+                transform->SetLocalRotation(transform->GetLocalRotation() + Vector<float, 3>{ 0.0f, 10.0f, 0.0f }, false);
+                transform->SetLocalScale({ 2.0f, 2.0f, 2.0f }, false);
+
+                everyFieldBytes += EncodedSize(MaskedSetField(path, entityId, componentType, transform, shadow));
+
+                NetworkEntityTable::GetInstance().ForgetPath(path);
+            }
+
+            const double count = static_cast<double>(kEntityCount);
+
+            std::cout << "  OpSetField bytes per Transform3d to a peer holding the entity binding: full state " << static_cast<double>(fullBytes) / count << ", fieldMask with position changed " << static_cast<double>(positionBytes) / count << ", fieldMask with every field changed " << static_cast<double>(everyFieldBytes) / count << "." << std::endl;
+        }
+
+        static OpSetField MaskedSetField(const std::string& path, const EntityId entityId, const int componentType, const std::shared_ptr<Transform3d>& transform, std::shared_ptr<void>& shadow)
+        {
+            const std::uint64_t fieldMask = MergeSupport::DiffFields(transform, shadow).value_or(0);
+
+            return OpSetField{ path, componentType, fieldMask, MergeSupport::EncodeFields(transform, fieldMask).value_or(std::vector<std::uint8_t>{}), entityId };
+        }
+
+        static std::size_t EncodedSize(const OpSetField& operation)
+        {
+            std::vector<std::uint8_t> buffer;
+
+            DataConversion<OpSetField>::Encode(operation, buffer);
+
+            return buffer.size();
+        }
+
+        static SnapshotTemplate BuildTemplate(std::mt19937& generator)
+        {
+            SnapshotTemplate snapshotTemplate{};
+
+            snapshotTemplate.snapshot.header.operationCount = 0;
+            snapshotTemplate.snapshot.header.route = Route::ServerBroadcast;
+            snapshotTemplate.snapshot.header.origin = 0;
+
+            std::uniform_int_distribution<int> byteDistribution(0, 255);
+            std::uniform_int_distribution<std::size_t> changeDistribution(0, kBlobSize - 1);
+
+            for (std::size_t i = 0; i < kEntityCount; ++i)
+            {
+                NetworkEntityTable::GetInstance().Assign(MakePath(i));
+
+                std::vector<std::uint8_t> blob(kBlobSize, static_cast<std::uint8_t>(i));
+
+                for (std::size_t change = 0; change < kChangedBytes; ++change)
+                    blob[changeDistribution(generator)] = static_cast<std::uint8_t>(byteDistribution(generator));
+
+                snapshotTemplate.Push(OpSetField{ MakePath(i), kComponentType, 0, std::move(blob) }, 0);
+            }
+
+            return snapshotTemplate;
+        }
+
+        static std::string MakePath(const std::size_t index)
+        {
+            return "benchmark-" + std::to_string(index);
+        }
+
+        static constexpr std::size_t kEntityCount = 512;
+        static constexpr std::size_t kIterations = 20;
+        static constexpr std::size_t kBlobSize = 96;
+        static constexpr std::size_t kChangedBytes = 8;
+
+        static constexpr int kComponentType = 1;
+        static constexpr NetworkId kFirstClientId = 0x40000000;
+
+    };
+}
\ No newline at end of file
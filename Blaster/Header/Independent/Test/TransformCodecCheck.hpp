@@ -0,0 +1,254 @@
+#pragma once
+
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+#include "Independent/ECS/GameObject.hpp"
+#include "Independent/ECS/MergeSupport.hpp"
+#include "Independent/Math/TransformCodec.hpp"
+
+using namespace Blaster::Independent::ECS;
+using namespace Blaster::Independent::Math;
+using namespace Blaster::Independent::Network;
+
+namespace Blaster::Independent::Test
+{
+    class TransformCodecCheck final
+    {
+
+    public:
+
+        TransformCodecCheck(const TransformCodecCheck&) = delete;
+        TransformCodecCheck(TransformCodecCheck&&) = delete;
+        TransformCodecCheck& operator=(const TransformCodecCheck&) = delete;
+        TransformCodecCheck& operator=(TransformCodecCheck&&) = delete;
+
+        static bool Run()
+        {
+            std::cout << "Transform codec check: " << kSampleCount << " samples per channel." << std::endl;
+
+            std::mt19937 generator(1234);
+
+            bool passed = true;
+
+            passed &= CheckVector("position", TransformCodec::GetPositionRange(), generator, &TransformCodec::WritePosition, &TransformCodec::ReadPosition);
+            passed &= CheckVector("linear velocity", TransformCodec::GetLinearVelocityRange(), generator, &TransformCodec::WriteLinearVelocity, &TransformCodec::ReadLinearVelocity);
+            passed &= CheckVector("angular velocity", TransformCodec::GetAngularVelocityRange(), generator, &TransformCodec::WriteAngularVelocity, &TransformCodec::ReadAngularVelocity);
+            passed &= CheckRotation(generator);
+            passed &= CheckTransform(generator);
+
+            ReportSizes(generator);
+
+            if (passed)
+                std::cout << "Transform codec check passed." << std::endl;
+            else
+                std::cerr << "Transform codec check FAILED!" << std::endl;
+
+            return passed;
+        }
+
+    private:
+
+        using VectorWriter = void(*)(BitWriter&, const Vector<float, 3>&);
+        using VectorReader = Vector<float, 3>(*)(BitReader&);
+
+        TransformCodecCheck() = default;
+
+        static float GetBound(const QuantizedRange& range)
+        {
+            const float magnitude = std::max(std::fabs(range.minimum), std::fabs(range.maximum));
+
+            return range.precision * 0.5f + magnitude * std::numeric_limits<float>::epsilon() * 2.0f;
+        }
+
+        static bool CheckVector(const char* name, const QuantizedRange& range, std::mt19937& generator, const VectorWriter write, const VectorReader read)
+        {
+            std::uniform_real_distribution<float> inside(range.minimum, range.maximum);
+            std::uniform_real_distribution<float> outside(range.maximum, range.maximum * 4.0f);
+
+            const float bound = GetBound(range);
+
+            float worst = 0.0f;
+
+            bool exact = true;
+
+            for (std::size_t sample = 0; sample < kSampleCount; ++sample)
+            {
+                const Vector<float, 3> value = { inside(generator), inside(generator), inside(generator) };
+
+                worst = std::max(worst, MaximumError(value, RoundTrip(value, write, read)));
+            }
+
+            for (std::size_t sample = 0; sample < kSampleCount / 100; ++sample)
+            {
+                const Vector<float, 3> value = { outside(generator), -outside(generator), 0.5f };
+
+                exact &= MaximumError(value, RoundTrip(value, write, read)) == 0.0f;
+            }
+
+            const bool passed = worst <= bound && exact;
+
+            std::cout << "  " << name << ": max error " << worst << " (bound " << bound << "), out-of-range samples " << (exact ? "exact" : "NOT exact") << (passed ? "." : " -- FAILED") << std::endl;
+
+            return passed;
+        }
+
+        static bool CheckRotation(std::mt19937& generator)
+        {
+            std::uniform_real_distribution<float> angle(-720.0f, 720.0f);
+
+            const float bound = TransformCodec::GetRotationStep() * 0.5f + 360.0f * std::numeric_limits<float>::epsilon() * 2.0f;
+
+            float worst = 0.0f;
+
+            for (std::size_t sample = 0; sample < kSampleCount; ++sample)
+            {
+                const Vector<float, 3> value = { angle(generator), angle(generator), angle(generator) };
+
+                BitWriter writer;
+
+                TransformCodec::WriteRotation(writer, value);
+
+                const std::vector<std::uint8_t> bytes = writer.Finish();
+
+                BitReader reader(bytes);
+
+                const Vector<float, 3> decoded = TransformCodec::ReadRotation(reader);
+
+                for (int i = 0; i < 3; ++i)
+                {
+                    const float difference = std::fabs(std::remainder(value[i] - decoded[i], 360.0f));
+
+                    worst = std::max(worst, difference);
+                }
+            }
+
+            const bool passed = worst <= bound;
+
+            std::cout << "  rotation: max error " << worst << " degrees (bound " << bound << ")" << (passed ? "." : " -- FAILED") << std::endl;
+
+            return passed;
+        }
+
+        static bool CheckTransform(std::mt19937& generator)
+        {
+            std::uniform_real_distribution<float> position(-1000.0f, 1000.0f);
+            std::uniform_real_distribution<float> angle(0.0f, 360.0f);
+
+            const float positionBound = GetBound(TransformCodec::GetPositionRange());
+            const float rotationBound = TransformCodec::GetRotationStep() * 0.5f + 360.0f * std::numeric_limits<float>::epsilon() * 2.0f;
+
+            bool passed = true;
+
+            for (std::size_t sample = 0; sample < kSampleCount / 10 && passed; ++sample)
+            {
+                const auto source = Transform3d::Create({ position(generator), position(generator), position(generator) }, { angle(generator), angle(generator), angle(generator) }, { 1.0f, 2.0f, 0.5f });
+                const auto destination = Transform3d::Create({ 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f });
+
+                std::shared_ptr<void> shadow;
+
+                const std::uint64_t mask = MergeSupport::DiffFields(source, shadow).value_or(0);
+                const auto blob = MergeSupport::EncodeFields(source, mask);
+
+                if (!blob.has_value() || !MergeSupport::ApplyFields(destination, mask, blob.value()))
+                {
+                    passed = false;
+                    break;
+                }
+
+                float rotationError = 0.0f;
+
+                for (int i = 0; i < 3; ++i)
+                    rotationError = std::max(rotationError, std::fabs(std::remainder(source->GetLocalRotation()[i] - destination->GetLocalRotation()[i], 360.0f)));
+
+                passed = MaximumError(source->GetLocalPosition(), destination->GetLocalPosition()) <= positionBound && rotationError <= rotationBound && destination->GetLocalScale() == source->GetLocalScale();
+            }
+
+            std::cout << "  Transform3d tracked fields: " << (passed ? "round trip within bounds." : "round trip FAILED.") << std::endl;
+
+            return passed;
+        }
+
+        static void ReportSizes(std::mt19937& generator)
+        {
+            std::uniform_real_distribution<float> position(-1000.0f, 1000.0f);
+            std::uniform_real_distribution<float> angle(0.0f, 360.0f);
+            std::uniform_real_distribution<float> speed(-20.0f, 20.0f);
+
+            std::size_t restingBytes = 0;
+            std::size_t movingBytes = 0;
+            std::size_t trackedBytes = 0;
+
+            for (std::size_t sample = 0; sample < kSampleCount; ++sample)
+            {
+                const Vector<float, 3> samplePosition = { position(generator), position(generator), position(generator) };
+                const Vector<float, 3> sampleRotation = { angle(generator), angle(generator), angle(generator) };
+
+                {
+                    BitWriter writer;
+
+                    TransformCodec::WritePosition(writer, samplePosition);
+                    TransformCodec::WriteRotation(writer, sampleRotation);
+                    TransformCodec::WriteLinearVelocity(writer, { 0.0f, 0.0f, 0.0f });
+                    TransformCodec::WriteAngularVelocity(writer, { 0.0f, 0.0f, 0.0f });
+
+                    restingBytes += writer.Finish().size();
+                }
+
+                {
+                    BitWriter writer;
+
+                    TransformCodec::WritePosition(writer, samplePosition);
+                    TransformCodec::WriteRotation(writer, sampleRotation);
+                    TransformCodec::WriteLinearVelocity(writer, { speed(generator), speed(generator), speed(generator) });
+                    TransformCodec::WriteAngularVelocity(writer, { speed(generator), speed(generator), speed(generator) });
+
+                    movingBytes += writer.Finish().size();
+                }
+
+                const auto transform = Transform3d::Create(samplePosition, sampleRotation, { 1.0f, 1.0f, 1.0f });
+
+                std::shared_ptr<void> shadow;
+
+                const std::uint64_t mask = MergeSupport::DiffFields(transform, shadow).value_or(0);
+
+                trackedBytes += MergeSupport::EncodeFields(transform, mask).value_or(std::vector<std::uint8_t>{}).size();
+            }
+
+            const double samples = static_cast<double>(kSampleCount);
+
+            std::cout << "  bytes per transform: raw floats " << kRawTransformBytes << ", resting " << static_cast<double>(restingBytes) / samples << ", moving " << static_cast<double>(movingBytes) / samples << ", full Transform3d field blob " << static_cast<double>(trackedBytes) / samples << "." << std::endl;
+        }
+
+        static Vector<float, 3> RoundTrip(const Vector<float, 3>& value, const VectorWriter write, const VectorReader read)
+        {
+            BitWriter writer;
+
+            write(writer, value);
+
+            const std::vector<std::uint8_t> bytes = writer.Finish();
+
+            BitReader reader(bytes);
+
+            return read(reader);
+        }
+
+        static float MaximumError(const Vector<float, 3>& expected, const Vector<float, 3>& actual)
+        {
+            float result = 0.0f;
+
+            for (int i = 0; i < 3; ++i)
+                result = std::max(result, std::fabs(expected[i] - actual[i]));
+
+            return result;
+        }
+
+        static constexpr std::size_t kSampleCount = 100000;
+
+        static constexpr std::size_t kRawTransformBytes = 5 * 3 * sizeof(float);
+
+    };
+}
\ No newline at end of file
@@ -0,0 +1,165 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Blaster::Independent::Thread
+{
+    class WorkerPool final
+    {
+
+    public:
+
+        WorkerPool(const WorkerPool&) = delete;
+        WorkerPool(WorkerPool&&) = delete;
+        WorkerPool& operator=(const WorkerPool&) = delete;
+        WorkerPool& operator=(WorkerPool&&) = delete;
+
+        ~WorkerPool()
+        {
+            {
+                std::lock_guard guard(mutex);
+                stopping = true;
+            }
+
+            wakeCondition.notify_all();
+        }
+
+        void ParallelFor(const std::size_t count, const std::function<void(std::size_t)>& function)
+        {
+            if (count == 0)
+                return;
+
+            if (count == 1 || workerList.empty())
+            {
+                for (std::size_t i = 0; i < count; ++i)
+                    function(i);
+
+                return;
+            }
+
+            std::lock_guard submitGuard(submitMutex);
+
+            const auto job = std::make_shared<Job>(&function, count);
+
+            {
+                std::lock_guard guard(mutex);
+
+                currentJob = job;
+                ++generation;
+            }
+
+            wakeCondition.notify_all();
+
+            RunJob(*job);
+
+            std::unique_lock guard(mutex);
+
+            doneCondition.wait(guard, [&job] { return job->completed.load(std::memory_order_acquire) == job->count; });
+
+            currentJob.reset();
+        }
+
+        [[nodiscard]]
+        std::size_t GetWorkerCount() const
+        {
+            return workerList.size();
+        }
+
+        static WorkerPool& GetInstance()
+        {
+            std::call_once(initializationFlag, [&]()
+            {
+                instance = std::unique_ptr<WorkerPool>(new WorkerPool());
+            });
+
+            return *instance;
+        }
+
+    private:
+
+        struct Job
+        {
+            Job(const std::function<void(std::size_t)>* function, const std::size_t count) : function(function), count(count) { }
+
+            const std::function<void(std::size_t)>* function;
+            const std::size_t count;
+
+            std::atomic<std::size_t> next{ 0 };
+            std::atomic<std::size_t> completed{ 0 };
+        };
+
+        WorkerPool()
+        {
+            const std::size_t workerCount = std::max(1u, std::thread::hardware_concurrency()) - 1;
+
+            for (std::size_t i = 0; i < workerCount; ++i)
+                workerList.emplace_back([this] { WorkerLoop(); });
+        }
+
+        void WorkerLoop()
+        {
+            std::uint64_t seenGeneration = 0;
+
+            while (true)
+            {
+                std::shared_ptr<Job> job;
+
+                {
+                    std::unique_lock guard(mutex);
+
+                    wakeCondition.wait(guard, [&] { return stopping || generation != seenGeneration; });
+
+                    if (stopping)
+                        return;
+
+                    seenGeneration = generation;
+                    job = currentJob;
+                }
+
+                if (job)
+                    RunJob(*job);
+            }
+        }
+
+        void RunJob(Job& job)
+        {
+            for (std::size_t index = job.next.fetch_add(1, std::memory_order_relaxed); index < job.count; index = job.next.fetch_add(1, std::memory_order_relaxed))
+            {
+                (*job.function)(index);
+
+                if (job.completed.fetch_add(1, std::memory_order_acq_rel) + 1 == job.count)
+                {
+                    std::lock_guard guard(mutex);
+                    doneCondition.notify_all();
+                }
+            }
+        }
+
+        std::mutex mutex;
+        std::mutex submitMutex;
+
+        std::condition_variable wakeCondition;
+        std::condition_variable doneCondition;
+
+        std::shared_ptr<Job> currentJob;
+        std::uint64_t generation{ 0 };
+
+        bool stopping{ false };
+
+        std::vector<std::jthread> workerList;
+
+        static std::once_flag initializationFlag;
+        static std::unique_ptr<WorkerPool> instance;
+
+    };
+
+    std::once_flag WorkerPool::initializationFlag;
+    std::unique_ptr<WorkerPool> WorkerPool::instance;
+}
\ No newline at end of file
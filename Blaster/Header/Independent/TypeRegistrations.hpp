@@ -15,6 +15,18 @@ namespace Blaster::Independent::ECS::Synchronization
     struct OpAddComponent;
     struct OpRemoveComponent;
     struct OpSetField;
+    struct OpDeltaField;
+    struct OpSpawn;
+    struct BaselineMiss;
+}
+
+namespace Blaster::Independent::Network
+{
+    struct SessionTicket;
+    struct ResumeRequest;
+    struct EntityHandoff;
+    struct HandoffToken;
+    struct ZoneRedirect;
 }
 
 namespace Blaster::Independent::Physics
@@ -44,10 +56,18 @@ REGISTER_TYPE(Blaster::Independent::ECS::Synchronization::OpDestroy, 22789)
 REGISTER_TYPE(Blaster::Independent::ECS::Synchronization::OpAddComponent, 36578)
 REGISTER_TYPE(Blaster::Independent::ECS::Synchronization::OpRemoveComponent, 13466)
 REGISTER_TYPE(Blaster::Independent::ECS::Synchronization::OpSetField, 87953)
+REGISTER_TYPE(Blaster::Independent::ECS::Synchronization::OpDeltaField, 46129)
+REGISTER_TYPE(Blaster::Independent::ECS::Synchronization::OpSpawn, 61742)
+REGISTER_TYPE(Blaster::Independent::ECS::Synchronization::BaselineMiss, 38915)
 REGISTER_TYPE(Blaster::Independent::Physics::ImpulseCommand, 25467)
 REGISTER_TYPE(Blaster::Independent::Physics::SetTransformCommand, 17834)
 REGISTER_TYPE(Blaster::Independent::Physics::SetVelocityCommand, 92123)
 REGISTER_TYPE(Blaster::Independent::Physics::CharacterControllerInputCommand, 12686)
+REGISTER_TYPE(Blaster::Independent::Network::SessionTicket, 51873)
+REGISTER_TYPE(Blaster::Independent::Network::ResumeRequest, 64219)
+REGISTER_TYPE(Blaster::Independent::Network::EntityHandoff, 73418)
+REGISTER_TYPE(Blaster::Independent::Network::HandoffToken, 28861)
+REGISTER_TYPE(Blaster::Independent::Network::ZoneRedirect, 55307)
 
 namespace Blaster::Independent::Utility
 {
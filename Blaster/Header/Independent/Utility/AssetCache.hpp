@@ -0,0 +1,281 @@
+#pragma once
+
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "Independent/Utility/AssetPath.hpp"
+#include "Independent/Utility/FileHelper.hpp"
+#include "Independent/Utility/Sha256.hpp"
+
+namespace Blaster::Independent::Utility
+{
+    using AssetHash = Sha256::Digest;
+
+    struct AssetHashHasher
+    {
+        std::size_t operator()(const AssetHash& hash) const noexcept
+        {
+            std::size_t result;
+
+            std::memcpy(&result, hash.data(), sizeof(result));
+
+            return result;
+        }
+    };
+
+    class AssetCache final
+    {
+
+    public:
+
+        using Provider = std::function<std::optional<std::string>()>;
+        using Callback = std::function<void(const std::string&)>;
+
+        AssetCache(const AssetCache&) = delete;
+        AssetCache(AssetCache&&) = delete;
+        AssetCache& operator=(const AssetCache&) = delete;
+        AssetCache& operator=(AssetCache&&) = delete;
+
+        AssetHash HashFile(const AssetPath& path)
+        {
+            const std::string fullPath = path.GetFullPath();
+
+            {
+                std::lock_guard guard(mutex);
+
+                if (const auto iterator = fileHashMap.find(fullPath); iterator != fileHashMap.end())
+                    return iterator->second;
+            }
+
+            const std::string contents = FileHelper::ReadFile(path);
+
+            const AssetHash hash = contents.empty() ? AssetHash{} : HashBytes(contents);
+
+            std::lock_guard guard(mutex);
+
+            fileHashMap[fullPath] = hash;
+
+            if (hash != AssetHash{})
+                providerMap.try_emplace(hash, [path]() -> std::optional<std::string> { return FileHelper::ReadFile(path); });
+
+            return hash;
+        }
+
+        void Publish(const AssetHash& hash, Provider provider)
+        {
+            std::lock_guard guard(mutex);
+
+            providerMap[hash] = std::move(provider);
+        }
+
+        std::optional<std::string> Find(const AssetHash& hash)
+        {
+            Provider provider;
+
+            {
+                std::lock_guard guard(mutex);
+
+                if (const auto iterator = blobMap.find(hash); iterator != blobMap.end())
+                    return iterator->second;
+
+                const auto iterator = providerMap.find(hash);
+
+                if (iterator == providerMap.end())
+                    return std::nullopt;
+
+                provider = iterator->second;
+            }
+
+            std::optional<std::string> result = provider();
+
+            if (!result.has_value() || HashBytes(result.value()) != hash)
+                return std::nullopt;
+
+            return result;
+        }
+
+        std::optional<std::string> Resolve(const AssetPath& path, const AssetHash& hash)
+        {
+            if (HashFile(path) == hash)
+                return FileHelper::ReadFile(path);
+
+            return Find(hash);
+        }
+
+        void Require(const AssetHash& hash, Callback callback)
+        {
+            if (const auto found = Find(hash); found.has_value())
+            {
+                callback(found.value());
+                return;
+            }
+
+            std::function<void(const AssetHash&)> request;
+
+            {
+                std::lock_guard guard(mutex);
+
+                auto& pending = pendingMap[hash];
+
+                pending.callbackList.push_back(std::move(callback));
+
+                if (pending.callbackList.size() > 1)
+                    return;
+
+                pending.requestTime = std::chrono::steady_clock::now();
+                pending.attempts = 1;
+
+                request = requestFunction;
+            }
+
+            std::cout << "Asset '" << Sha256::ToHex(hash) << "' is missing locally; requesting transfer." << std::endl;
+
+            if (request)
+                request(hash);
+        }
+
+        void Pump()
+        {
+            const auto now = std::chrono::steady_clock::now();
+
+            std::vector<AssetHash> retryList;
+            std::function<void(const AssetHash&)> request;
+
+            {
+                std::lock_guard guard(mutex);
+
+                for (auto iterator = pendingMap.begin(); iterator != pendingMap.end(); )
+                {
+                    PendingAsset& pending = iterator->second;
+
+                    if (now - pending.requestTime < kRetryInterval)
+                    {
+                        ++iterator;
+                        continue;
+                    }
+
+                    if (pending.attempts >= kMaximumAttempts)
+                    {
+                        std::cerr << "Giving up on asset '" << Sha256::ToHex(iterator->first) << "' after '" << pending.attempts << "' request(s)." << std::endl;
+
+                        iterator = pendingMap.erase(iterator);
+                        continue;
+                    }
+
+                    pending.requestTime = now;
+                    ++pending.attempts;
+
+                    retryList.push_back(iterator->first);
+
+                    ++iterator;
+                }
+
+                request = requestFunction;
+            }
+
+            if (!request)
+                return;
+
+            for (const AssetHash& hash : retryList)
+            {
+                std::cout << "Asset '" << Sha256::ToHex(hash) << "' is still missing; requesting it again." << std::endl;
+
+                request(hash);
+            }
+        }
+
+        bool Store(const AssetHash& hash, std::string bytes)
+        {
+            if (HashBytes(bytes) != hash)
+            {
+                std::cerr << "Rejected asset transfer '" << Sha256::ToHex(hash) << "' with mismatched content." << std::endl;
+                return false;
+            }
+
+            std::vector<Callback> waiting;
+
+            {
+                std::lock_guard guard(mutex);
+
+                const auto iterator = pendingMap.find(hash);
+
+                if (iterator == pendingMap.end())
+                    return false;
+
+                waiting = std::move(iterator->second.callbackList);
+
+                pendingMap.erase(iterator);
+
+                blobMap[hash] = bytes;
+            }
+
+            std::cout << "Received asset '" << Sha256::ToHex(hash) << "' (" << bytes.size() << " bytes)." << std::endl;
+
+            for (const auto& callback : waiting)
+                callback(bytes);
+
+            return true;
+        }
+
+        void SetRequestFunction(std::function<void(const AssetHash&)> function)
+        {
+            std::lock_guard guard(mutex);
+
+            requestFunction = std::move(function);
+        }
+
+        static AssetHash HashBytes(const std::string_view bytes)
+        {
+            return Sha256::Hash(bytes);
+        }
+
+        static AssetCache& GetInstance()
+        {
+            std::call_once(initializationFlag, [&]()
+            {
+                instance = std::unique_ptr<AssetCache>(new AssetCache());
+            });
+
+            return *instance;
+        }
+
+    private:
+
+        struct PendingAsset
+        {
+            std::vector<Callback> callbackList;
+
+            std::chrono::steady_clock::time_point requestTime;
+            std::size_t attempts{ 0 };
+        };
+
+        AssetCache() = default;
+
+        std::unordered_map<std::string, AssetHash> fileHashMap;
+        std::unordered_map<AssetHash, Provider, AssetHashHasher> providerMap;
+        std::unordered_map<AssetHash, std::string, AssetHashHasher> blobMap;
+        std::unordered_map<AssetHash, PendingAsset, AssetHashHasher> pendingMap;
+
+        std::function<void(const AssetHash&)> requestFunction;
+
+        std::mutex mutex;
+
+        static constexpr std::chrono::seconds kRetryInterval{ 2 };
+        static constexpr std::size_t kMaximumAttempts = 5;
+
+        static std::once_flag initializationFlag;
+        static std::unique_ptr<AssetCache> instance;
+
+    };
+
+    std::once_flag AssetCache::initializationFlag;
+    std::unique_ptr<AssetCache> AssetCache::instance;
+}
\ No newline at end of file
@@ -65,13 +65,13 @@ namespace Blaster::Independent::Utility
         }
 
         [[nodiscard]]
-        bool operator==(const AssetPath& other)
+        bool operator==(const AssetPath& other) const
         {
-            return OPERATOR_CHECK(domain, localPath);
+            return domain == other.domain && localPath == other.localPath;
         }
 
         [[nodiscard]]
-        bool operator!=(const AssetPath& other)
+        bool operator!=(const AssetPath& other) const
         {
             return !(*this == other);
         }
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <bcrypt.h>
+#pragma comment(lib, "bcrypt.lib")
+#else
+#include <sys/random.h>
+#endif
+
+namespace Blaster::Independent::Utility
+{
+    class SecureRandom final
+    {
+
+    public:
+
+        SecureRandom(const SecureRandom&) = delete;
+        SecureRandom(SecureRandom&&) = delete;
+        SecureRandom& operator=(const SecureRandom&) = delete;
+        SecureRandom& operator=(SecureRandom&&) = delete;
+
+        static std::uint64_t NextToken()
+        {
+            std::uint64_t result = 0;
+
+#ifdef _WIN32
+            if (!BCRYPT_SUCCESS(BCryptGenRandom(nullptr, reinterpret_cast<PUCHAR>(&result), sizeof(result), BCRYPT_USE_SYSTEM_PREFERRED_RNG)))
+                throw std::runtime_error("BCryptGenRandom failed to produce a token!");
+#else
+            if (getentropy(&result, sizeof(result)) != 0)
+                throw std::runtime_error("getentropy failed to produce a token!");
+#endif
+
+            return result;
+        }
+
+    private:
+
+        SecureRandom() = default;
+
+    };
+}
\ No newline at end of file
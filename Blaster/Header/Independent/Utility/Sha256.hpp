@@ -0,0 +1,147 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace Blaster::Independent::Utility
+{
+    class Sha256 final
+    {
+
+    public:
+
+        using Digest = std::array<std::uint8_t, 32>;
+
+        Sha256(const Sha256&) = delete;
+        Sha256(Sha256&&) = delete;
+        Sha256& operator=(const Sha256&) = delete;
+        Sha256& operator=(Sha256&&) = delete;
+
+        static Digest Hash(const std::string_view bytes)
+        {
+            std::array<std::uint32_t, 8> state = kInitialState;
+
+            const std::size_t fullBlocks = bytes.size() / kBlockSize;
+
+            for (std::size_t block = 0; block < fullBlocks; ++block)
+                Compress(state, reinterpret_cast<const std::uint8_t*>(bytes.data()) + block * kBlockSize);
+
+            std::array<std::uint8_t, kBlockSize * 2> tail{};
+
+            const std::size_t remainder = bytes.size() - fullBlocks * kBlockSize;
+
+            for (std::size_t i = 0; i < remainder; ++i)
+                tail[i] = static_cast<std::uint8_t>(bytes[fullBlocks * kBlockSize + i]);
+
+            tail[remainder] = 0x80;
+
+            const std::size_t tailSize = remainder + 1 + sizeof(std::uint64_t) <= kBlockSize ? kBlockSize : kBlockSize * 2;
+            const std::uint64_t bitCount = static_cast<std::uint64_t>(bytes.size()) * 8;
+
+            for (std::size_t i = 0; i < sizeof(std::uint64_t); ++i)
+                tail[tailSize - 1 - i] = static_cast<std::uint8_t>(bitCount >> (i * 8));
+
+            for (std::size_t offset = 0; offset < tailSize; offset += kBlockSize)
+                Compress(state, tail.data() + offset);
+
+            Digest result{};
+
+            for (std::size_t i = 0; i < state.size(); ++i)
+            {
+                result[i * 4] = static_cast<std::uint8_t>(state[i] >> 24);
+                result[i * 4 + 1] = static_cast<std::uint8_t>(state[i] >> 16);
+                result[i * 4 + 2] = static_cast<std::uint8_t>(state[i] >> 8);
+                result[i * 4 + 3] = static_cast<std::uint8_t>(state[i]);
+            }
+
+            return result;
+        }
+
+        static std::string ToHex(const Digest& digest)
+        {
+            static constexpr char kHexDigits[] = "0123456789abcdef";
+
+            std::string result;
+
+            result.reserve(digest.size() * 2);
+
+            for (const std::uint8_t byte : digest)
+            {
+                result.push_back(kHexDigits[byte >> 4]);
+                result.push_back(kHexDigits[byte & 0x0F]);
+            }
+
+            return result;
+        }
+
+    private:
+
+        Sha256() = default;
+
+        static void Compress(std::array<std::uint32_t, 8>& state, const std::uint8_t* block)
+        {
+            std::array<std::uint32_t, 64> schedule{};
+
+            for (std::size_t i = 0; i < 16; ++i)
+                schedule[i] = static_cast<std::uint32_t>(block[i * 4]) << 24 | static_cast<std::uint32_t>(block[i * 4 + 1]) << 16 | static_cast<std::uint32_t>(block[i * 4 + 2]) << 8 | static_cast<std::uint32_t>(block[i * 4 + 3]);
+
+            for (std::size_t i = 16; i < 64; ++i)
+            {
+                const std::uint32_t sigma0 = std::rotr(schedule[i - 15], 7) ^ std::rotr(schedule[i - 15], 18) ^ (schedule[i - 15] >> 3);
+                const std::uint32_t sigma1 = std::rotr(schedule[i - 2], 17) ^ std::rotr(schedule[i - 2], 19) ^ (schedule[i - 2] >> 10);
+
+                schedule[i] = schedule[i - 16] + sigma0 + schedule[i - 7] + sigma1;
+            }
+
+            std::array<std::uint32_t, 8> working = state;
+
+            for (std::size_t i = 0; i < 64; ++i)
+            {
+                auto& [a, b, c, d, e, f, g, h] = working;
+
+                const std::uint32_t sum1 = std::rotr(e, 6) ^ std::rotr(e, 11) ^ std::rotr(e, 25);
+                const std::uint32_t choose = (e & f) ^ (~e & g);
+                const std::uint32_t first = h + sum1 + choose + kRoundConstants[i] + schedule[i];
+
+                const std::uint32_t sum0 = std::rotr(a, 2) ^ std::rotr(a, 13) ^ std::rotr(a, 22);
+                const std::uint32_t majority = (a & b) ^ (a & c) ^ (b & c);
+                const std::uint32_t second = sum0 + majority;
+
+                h = g;
+                g = f;
+                f = e;
+                e = d + first;
+                d = c;
+                c = b;
+                b = a;
+                a = first + second;
+            }
+
+            for (std::size_t i = 0; i < state.size(); ++i)
+                state[i] += working[i];
+        }
+
+        static constexpr std::size_t kBlockSize = 64;
+
+        static constexpr std::array<std::uint32_t, 8> kInitialState =
+        {
+            0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+        };
+
+        static constexpr std::array<std::uint32_t, 64> kRoundConstants =
+        {
+            0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+            0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+            0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+            0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+            0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+            0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+            0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+            0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+        };
+
+    };
+}
\ No newline at end of file
@@ -0,0 +1,263 @@
+#pragma once
+
+#include <array>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <ranges>
+#include <unordered_map>
+#include <boost/asio.hpp>
+#include "Independent/ECS/Synchronization/CommonSynchronization.hpp"
+#include "Independent/Network/CommonNetwork.hpp"
+
+using namespace Blaster::Independent::ECS::Synchronization;
+using namespace Blaster::Independent::Network;
+
+namespace Blaster::Relay::Network
+{
+    class SpectatorNetwork final
+    {
+
+    public:
+
+        SpectatorNetwork(const SpectatorNetwork&) = delete;
+        SpectatorNetwork(SpectatorNetwork&&) = delete;
+        SpectatorNetwork& operator=(const SpectatorNetwork&) = delete;
+        SpectatorNetwork& operator=(SpectatorNetwork&&) = delete;
+
+        struct SpectatorReference
+        {
+            TcpProtocol::socket socket;
+
+            NetworkId id{};
+            std::string stringId = "!";
+
+            bool live{ false };
+
+            std::deque<std::shared_ptr<const std::vector<std::uint8_t>>> writeQueue;
+            std::size_t queuedBytes{ 0 };
+
+            std::array<std::uint8_t, 512> readBuffer{};
+            std::vector<std::uint8_t> inbox;
+
+            explicit SpectatorReference(TcpProtocol::socket socket) : socket(std::move(socket)) { }
+        };
+
+        void Initialize(boost::asio::io_context& ioContext, const std::uint16_t port)
+        {
+            this->ioContext = &ioContext;
+
+            acceptor.emplace(ioContext, TcpProtocol::endpoint(TcpProtocol::v4(), port));
+
+            DoAccept();
+
+            std::cout << "Relay serving spectators on port '" << port << "'." << std::endl;
+        }
+
+        void SetOnSpectatorJoinedCallback(const std::function<void(NetworkId)>& callback)
+        {
+            onSpectatorJoinedCallback = callback;
+        }
+
+        void Broadcast(const Snapshot& snapshot)
+        {
+            auto buffer = std::make_shared<const std::vector<std::uint8_t>>(CommonNetwork::BuildPacket(PacketType::S2C_Snapshot, 0, snapshot));
+
+            boost::asio::post(*ioContext, [this, buffer]
+                {
+                    for (const auto& spectator : spectatorMap | std::views::values)
+                    {
+                        if (spectator->live)
+                            Enqueue(spectator, buffer);
+                    }
+                });
+        }
+
+        void SendLateJoin(const NetworkId id, const Snapshot& snapshot)
+        {
+            auto buffer = std::make_shared<const std::vector<std::uint8_t>>(CommonNetwork::BuildPacket(PacketType::S2C_Snapshot, 0, snapshot));
+
+            boost::asio::post(*ioContext, [this, id, buffer]
+                {
+                    const auto hit = spectatorMap.find(id);
+
+                    if (hit == spectatorMap.end())
+                        return;
+
+                    hit->second->live = true;
+
+                    Enqueue(hit->second, buffer);
+
+                    std::cout << "Spectator '" << hit->second->stringId << "' joined with a '" << buffer->size() << "' byte snapshot (" << spectatorMap.size() << " watching)." << std::endl;
+                });
+        }
+
+        void Uninitialize()
+        {
+            ErrorCode ignored;
+
+            if (acceptor.has_value())
+                acceptor->close(ignored);
+
+            for (const auto& spectator : spectatorMap | std::views::values)
+                spectator->socket.close(ignored);
+
+            spectatorMap.clear();
+        }
+
+        static SpectatorNetwork& GetInstance()
+        {
+            std::call_once(initializationFlag, [&]()
+            {
+                instance = std::unique_ptr<SpectatorNetwork>(new SpectatorNetwork());
+            });
+
+            return *instance;
+        }
+
+    private:
+
+        SpectatorNetwork() = default;
+
+        void DoAccept()
+        {
+            acceptor->async_accept([this](const ErrorCode& errorCode, TcpProtocol::socket socket)
+                {
+                    if (errorCode == boost::asio::error::operation_aborted)
+                        return;
+
+                    if (!errorCode)
+                    {
+                        socket.set_option(TcpProtocol::no_delay(true));
+
+                        const auto spectator = std::make_shared<SpectatorReference>(std::move(socket));
+
+                        spectator->id = ++nextId;
+                        spectatorMap[spectator->id] = spectator;
+
+                        Enqueue(spectator, std::make_shared<const std::vector<std::uint8_t>>(CommonNetwork::BuildPacket(PacketType::S2C_AssignNetworkId, 0, spectator->id)));
+                        Enqueue(spectator, std::make_shared<const std::vector<std::uint8_t>>(CommonNetwork::BuildPacket(PacketType::S2C_RequestStringId, 0, 0)));
+
+                        BeginRead(spectator);
+                    }
+
+                    DoAccept();
+                });
+        }
+
+        void Enqueue(const std::shared_ptr<SpectatorReference>& spectator, const std::shared_ptr<const std::vector<std::uint8_t>>& buffer)
+        {
+            if (spectator->queuedBytes + buffer->size() > kMaximumQueuedBytes)
+            {
+                Drop(spectator, "fell too far behind");
+                return;
+            }
+
+            spectator->queuedBytes += buffer->size();
+            spectator->writeQueue.push_back(buffer);
+
+            if (spectator->writeQueue.size() == 1)
+                StartWrite(spectator);
+        }
+
+        void StartWrite(const std::shared_ptr<SpectatorReference>& spectator)
+        {
+            boost::asio::async_write(spectator->socket, boost::asio::buffer(*spectator->writeQueue.front()), [this, spectator](const ErrorCode& error, std::size_t)
+                {
+                    if (error)
+                    {
+                        Drop(spectator, error.message());
+                        return;
+                    }
+
+                    spectator->queuedBytes -= spectator->writeQueue.front()->size();
+                    spectator->writeQueue.pop_front();
+
+                    if (!spectator->writeQueue.empty())
+                        StartWrite(spectator);
+                });
+        }
+
+        void BeginRead(const std::shared_ptr<SpectatorReference>& spectator)
+        {
+            spectator->socket.async_read_some(boost::asio::buffer(spectator->readBuffer), [this, spectator](const ErrorCode& errorCode, const std::size_t number)
+                {
+                    if (errorCode)
+                    {
+                        Drop(spectator, errorCode.message());
+                        return;
+                    }
+
+                    spectator->inbox.insert(spectator->inbox.end(), spectator->readBuffer.data(), spectator->readBuffer.data() + number);
+
+                    while (spectator->inbox.size() >= sizeof(PacketHeader))
+                    {
+                        const PacketHeader header = *reinterpret_cast<const PacketHeader*>(spectator->inbox.data());
+
+                        if (header.size > kMaximumInboundPacket)
+                        {
+                            Drop(spectator, "oversized packet");
+                            return;
+                        }
+
+                        const std::size_t needed = sizeof(PacketHeader) + header.size;
+
+                        if (spectator->inbox.size() < needed)
+                            break;
+
+                        if (header.type == PacketType::C2S_StringId && !spectator->live)
+                        {
+                            std::vector<std::uint8_t> payload(spectator->inbox.begin() + sizeof(PacketHeader), spectator->inbox.begin() + needed);
+
+                            spectator->stringId = std::any_cast<std::string>(CommonNetwork::DisassembleData(payload)[0]);
+
+                            if (onSpectatorJoinedCallback)
+                                onSpectatorJoinedCallback(spectator->id);
+                        }
+
+                        spectator->inbox.erase(spectator->inbox.begin(), spectator->inbox.begin() + needed);
+                    }
+
+                    BeginRead(spectator);
+                });
+        }
+
+        void Drop(const std::shared_ptr<SpectatorReference>& spectator, const std::string& reason)
+        {
+            const auto hit = spectatorMap.find(spectator->id);
+
+            if (hit == spectatorMap.end() || hit->second != spectator)
+                return;
+
+            ErrorCode ignored;
+
+            spectator->socket.close(ignored);
+
+            spectatorMap.erase(hit);
+
+            std::cout << "Spectator '" << spectator->stringId << "' left (" << reason << "), " << spectatorMap.size() << " watching." << std::endl;
+        }
+
+        boost::asio::io_context* ioContext = nullptr;
+
+        std::optional<TcpProtocol::acceptor> acceptor;
+
+        std::unordered_map<NetworkId, std::shared_ptr<SpectatorReference>> spectatorMap;
+
+        NetworkId nextId{ 0 };
+
+        std::function<void(NetworkId)> onSpectatorJoinedCallback;
+
+        inline static constexpr std::size_t kMaximumQueuedBytes = 8 * 1024 * 1024;
+        inline static constexpr std::size_t kMaximumInboundPacket = 64 * 1024;
+
+        static std::once_flag initializationFlag;
+        static std::unique_ptr<SpectatorNetwork> instance;
+
+    };
+
+    std::once_flag SpectatorNetwork::initializationFlag;
+    std::unique_ptr<SpectatorNetwork> SpectatorNetwork::instance;
+}
\ No newline at end of file
@@ -0,0 +1,278 @@
+#pragma once
+
+#include <array>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <boost/asio.hpp>
+#include "Independent/ECS/Synchronization/CommonSynchronization.hpp"
+#include "Independent/Network/CommonNetwork.hpp"
+#include "Independent/Network/WorldChunk.hpp"
+
+using namespace Blaster::Independent::ECS::Synchronization;
+using namespace Blaster::Independent::Network;
+
+namespace Blaster::Relay::Network
+{
+    class UpstreamLink final
+    {
+
+    public:
+
+        UpstreamLink(const UpstreamLink&) = delete;
+        UpstreamLink(UpstreamLink&&) = delete;
+        UpstreamLink& operator=(const UpstreamLink&) = delete;
+        UpstreamLink& operator=(UpstreamLink&&) = delete;
+
+        void Initialize(boost::asio::io_context& ioContext, const std::string_view host, const std::uint16_t port, const std::string& relayKey)
+        {
+            this->relayKey = relayKey;
+
+            socket.emplace(ioContext);
+            ackTimer.emplace(ioContext);
+
+            TcpProtocol::resolver resolver{ ioContext };
+
+            boost::asio::connect(socket.value(), resolver.resolve(host, std::to_string(port)));
+
+            socket->set_option(TcpProtocol::no_delay(true));
+
+            connected = true;
+
+            std::cout << "Relay connected to game server at '" << host << ":" << port << "'." << std::endl;
+
+            BeginRead();
+            ScheduleAck();
+        }
+
+        void SetOnSnapshotCallback(const std::function<void(Snapshot)>& callback)
+        {
+            onSnapshotCallback = callback;
+        }
+
+        void SetOnConnectionLostCallback(const std::function<void()>& callback)
+        {
+            onConnectionLostCallback = callback;
+        }
+
+        [[nodiscard]]
+        bool IsConnected() const
+        {
+            return connected;
+        }
+
+        void Uninitialize()
+        {
+            ErrorCode ignored;
+
+            if (ackTimer.has_value())
+                ackTimer->cancel();
+
+            if (socket.has_value())
+                socket->close(ignored);
+
+            connected = false;
+        }
+
+        static UpstreamLink& GetInstance()
+        {
+            std::call_once(initializationFlag, [&]()
+            {
+                instance = std::unique_ptr<UpstreamLink>(new UpstreamLink());
+            });
+
+            return *instance;
+        }
+
+    private:
+
+        UpstreamLink() = default;
+
+        template <typename... Args> requires DataConvertible<Args...>
+        void Send(const PacketType type, Args&&... args)
+        {
+            auto buffer = std::make_shared<std::vector<std::uint8_t>>(CommonNetwork::BuildPacket(type, networkId, std::forward<Args>(args)...));
+
+            writeQueue.push_back(buffer);
+
+            if (writeQueue.size() == 1)
+                StartWrite();
+        }
+
+        void StartWrite()
+        {
+            boost::asio::async_write(socket.value(), boost::asio::buffer(*writeQueue.front()), [this](const ErrorCode& error, std::size_t)
+                {
+                    if (error)
+                    {
+                        HandleConnectionLost(error);
+                        return;
+                    }
+
+                    writeQueue.pop_front();
+
+                    if (!writeQueue.empty())
+                        StartWrite();
+                });
+        }
+
+        void BeginRead()
+        {
+            socket->async_read_some(boost::asio::buffer(readBuffer), [this](const ErrorCode& errorCode, const std::size_t number)
+                {
+                    if (errorCode)
+                    {
+                        HandleConnectionLost(errorCode);
+                        return;
+                    }
+
+                    inbox.insert(inbox.end(), readBuffer.data(), readBuffer.data() + number);
+
+                    while (inbox.size() >= sizeof(PacketHeader))
+                    {
+                        const PacketHeader header = *reinterpret_cast<const PacketHeader*>(inbox.data());
+
+                        const std::size_t needed = sizeof(PacketHeader) + header.size;
+
+                        if (inbox.size() < needed)
+                            break;
+
+                        std::vector<std::uint8_t> payload(inbox.begin() + sizeof(PacketHeader), inbox.begin() + needed);
+
+                        inbox.erase(inbox.begin(), inbox.begin() + needed);
+
+                        HandlePacket(header, std::move(payload));
+                    }
+
+                    BeginRead();
+                });
+        }
+
+        void HandlePacket(const PacketHeader& header, std::vector<std::uint8_t>&& data)
+        {
+            if (header.type == PacketType::S2C_AssignNetworkId)
+            {
+                networkId = std::any_cast<NetworkId>(CommonNetwork::DisassembleData(data)[0]);
+                return;
+            }
+
+            if (header.type == PacketType::S2C_RequestStringId)
+            {
+                Send(PacketType::C2S_RelayHello, relayKey);
+                return;
+            }
+
+            if (header.type == PacketType::S2C_WorldChunk)
+            {
+                auto chunkList = CommonNetwork::DisassembleData(data);
+
+                if (chunkList.empty())
+                    return;
+
+                auto payload = WorldChunkCodec::Decompress(std::any_cast<const WorldChunk&>(chunkList.front()));
+
+                if (!payload.has_value())
+                {
+                    std::cerr << "Failed to decompress world chunk from upstream." << std::endl;
+                    return;
+                }
+
+                data = std::move(payload.value());
+            }
+            else if (header.type != PacketType::S2C_Snapshot)
+                return;
+
+            auto anyList = CommonNetwork::DisassembleData(data);
+
+            if (anyList.empty())
+                return;
+
+            auto snapshot = std::any_cast<Snapshot>(std::move(anyList.front()));
+
+            std::uint64_t& lastSequence = lastSequenceMap[snapshot.header.origin];
+
+            if (snapshot.header.sequence <= lastSequence)
+                return;
+
+            lastSequence = snapshot.header.sequence;
+
+            if (onSnapshotCallback)
+                onSnapshotCallback(std::move(snapshot));
+        }
+
+        void ScheduleAck()
+        {
+            ackTimer->expires_after(kAckInterval);
+            ackTimer->async_wait([this](const ErrorCode& errorCode)
+                {
+                    if (errorCode || !connected)
+                        return;
+
+                    const std::uint64_t serverSequence = lastSequenceMap[0];
+
+                    if (serverSequence > lastAckSent && networkId != 0)
+                    {
+                        Snapshot snapshot{};
+
+                        snapshot.header.sequence = ++outgoingSequence;
+                        snapshot.header.operationCount = 0;
+                        snapshot.header.ack = serverSequence;
+                        snapshot.header.route = Route::ToServerOnly;
+                        snapshot.header.origin = networkId;
+
+                        Send(PacketType::C2S_Snapshot, snapshot);
+
+                        lastAckSent = serverSequence;
+                    }
+
+                    ScheduleAck();
+                });
+        }
+
+        void HandleConnectionLost(const ErrorCode& errorCode)
+        {
+            if (!connected)
+                return;
+
+            connected = false;
+
+            std::cerr << "Relay lost the game server: " << errorCode.message() << std::endl;
+
+            if (onConnectionLostCallback)
+                onConnectionLostCallback();
+        }
+
+        std::optional<TcpProtocol::socket> socket;
+        std::optional<boost::asio::steady_timer> ackTimer;
+
+        std::string relayKey;
+
+        NetworkId networkId{ 0 };
+
+        std::atomic<bool> connected = false;
+
+        std::array<std::uint8_t, 4096> readBuffer{};
+        std::vector<std::uint8_t> inbox;
+
+        std::deque<std::shared_ptr<std::vector<std::uint8_t>>> writeQueue;
+
+        std::unordered_map<NetworkId, std::uint64_t> lastSequenceMap;
+
+        std::uint64_t outgoingSequence{ 0 };
+        std::uint64_t lastAckSent{ 0 };
+
+        std::function<void(Snapshot)> onSnapshotCallback;
+        std::function<void()> onConnectionLostCallback;
+
+        inline static constexpr std::chrono::milliseconds kAckInterval{ 100 };
+
+        static std::once_flag initializationFlag;
+        static std::unique_ptr<UpstreamLink> instance;
+
+    };
+
+    std::once_flag UpstreamLink::initializationFlag;
+    std::unique_ptr<UpstreamLink> UpstreamLink::instance;
+}
\ No newline at end of file
@@ -0,0 +1,179 @@
+#pragma once
+
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "Independent/Thread/MainThreadExecutor.hpp"
+#include "Relay/Network/SpectatorNetwork.hpp"
+#include "Relay/Network/UpstreamLink.hpp"
+#include "Relay/RelayWorld.hpp"
+
+using namespace Blaster::Independent::Thread;
+using namespace Blaster::Relay::Network;
+using namespace std::chrono_literals;
+
+namespace Blaster::Relay
+{
+    class RelayApplication final
+    {
+
+    public:
+
+        RelayApplication(const RelayApplication&) = delete;
+        RelayApplication(RelayApplication&&) = delete;
+        RelayApplication& operator=(const RelayApplication&) = delete;
+        RelayApplication& operator=(RelayApplication&&) = delete;
+
+        void PreInitialize() { }
+
+        void Initialize()
+        {
+            std::string ip;
+            std::uint16_t upstreamPort;
+            std::uint16_t spectatorPort;
+            std::uint32_t delayMilliseconds;
+
+            std::cout << "Enter game server IPv4: ";
+            std::cin >> ip;
+
+            std::cout << "Enter game server PORT: ";
+            std::cin >> upstreamPort;
+
+            std::cout << "Enter spectator PORT: ";
+            std::cin >> spectatorPort;
+
+            std::cout << "Enter broadcast DELAY (ms): ";
+            std::cin >> delayMilliseconds;
+
+            delay = std::chrono::milliseconds(delayMilliseconds);
+
+            const char* relayKey = std::getenv("BLASTER_RELAY_KEY");
+
+            if (relayKey == nullptr)
+                std::cerr << "BLASTER_RELAY_KEY is not set; the game server will refuse this relay." << std::endl;
+
+            UpstreamLink::GetInstance().SetOnSnapshotCallback([this](Snapshot snapshot)
+                {
+                    MainThreadExecutor::GetInstance().EnqueueTask(nullptr, [this, snapshot = std::move(snapshot)]() mutable
+                    {
+                        pendingList.push_back({ std::chrono::steady_clock::now() + delay, std::move(snapshot) });
+                    });
+                });
+
+            UpstreamLink::GetInstance().SetOnConnectionLostCallback([this]
+                {
+                    running = false;
+                });
+
+            SpectatorNetwork::GetInstance().SetOnSpectatorJoinedCallback([this](const NetworkId id)
+                {
+                    MainThreadExecutor::GetInstance().EnqueueTask(nullptr, [this, id]
+                    {
+                        Snapshot snapshot = world.BuildLateJoinSnapshot();
+
+                        snapshot.header.sequence = ++sequence;
+
+                        SpectatorNetwork::GetInstance().SendLateJoin(id, snapshot);
+                    });
+                });
+
+            SpectatorNetwork::GetInstance().Initialize(ioContext, spectatorPort);
+            UpstreamLink::GetInstance().Initialize(ioContext, ip, upstreamPort, relayKey == nullptr ? "" : relayKey);
+
+            ioThread = std::thread([this] { ioContext.run(); });
+
+            running = true;
+        }
+
+        bool IsRunning()
+        {
+            return running;
+        }
+
+        void Update()
+        {
+            MainThreadExecutor::GetInstance().Execute();
+
+            const auto now = std::chrono::steady_clock::now();
+
+            while (!pendingList.empty() && pendingList.front().releaseTime <= now)
+            {
+                Snapshot snapshot = std::move(pendingList.front().snapshot);
+
+                pendingList.pop_front();
+
+                world.Apply(snapshot);
+
+                if (snapshot.header.operationCount == 0)
+                    continue;
+
+                snapshot.header.sequence = ++sequence;
+                snapshot.header.ack = 0;
+                snapshot.header.route = Route::ServerBroadcast;
+                snapshot.header.origin = 0;
+
+                SpectatorNetwork::GetInstance().Broadcast(snapshot);
+            }
+
+            std::this_thread::sleep_for(kIdleSleep);
+        }
+
+        void Uninitialize()
+        {
+            UpstreamLink::GetInstance().Uninitialize();
+
+            ioContext.stop();
+
+            if (ioThread.joinable())
+                ioThread.join();
+
+            SpectatorNetwork::GetInstance().Uninitialize();
+        }
+
+        static RelayApplication& GetInstance()
+        {
+            std::call_once(initializationFlag, [&]()
+            {
+                instance = std::unique_ptr<RelayApplication>(new RelayApplication());
+            });
+
+            return *instance;
+        }
+
+    private:
+
+        struct PendingSnapshot
+        {
+            std::chrono::steady_clock::time_point releaseTime;
+
+            Snapshot snapshot;
+        };
+
+        RelayApplication() = default;
+
+        boost::asio::io_context ioContext;
+        std::thread ioThread;
+
+        std::atomic<bool> running = false;
+
+        std::chrono::milliseconds delay{ 0 };
+        std::deque<PendingSnapshot> pendingList;
+
+        RelayWorld world;
+
+        std::uint64_t sequence{ 0 };
+
+        inline static constexpr std::chrono::milliseconds kIdleSleep{ 1 };
+
+        static std::once_flag initializationFlag;
+        static std::unique_ptr<RelayApplication> instance;
+
+    };
+
+    std::once_flag RelayApplication::initializationFlag;
+    std::unique_ptr<RelayApplication> RelayApplication::instance;
+}
\ No newline at end of file
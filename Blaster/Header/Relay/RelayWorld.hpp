@@ -0,0 +1,331 @@
+#pragma once
+
+#include <algorithm>
+#include <map>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <vector>
+#include "Independent/ECS/Synchronization/CommonSynchronization.hpp"
+
+using namespace Blaster::Independent::ECS::Synchronization;
+using namespace Blaster::Independent::Network;
+
+namespace Blaster::Relay
+{
+    struct RelayFieldPatch
+    {
+        std::uint64_t fieldMask{ 0 };
+
+        std::vector<std::uint8_t> blob;
+    };
+
+    struct RelayComponent
+    {
+        int componentType{ 0 };
+
+        std::vector<std::uint8_t> blob;
+
+        std::vector<RelayFieldPatch> patchList;
+    };
+
+    struct RelayEntity
+    {
+        OpCreate create;
+        std::optional<OpSpawn> spawn;
+
+        bool implicit{ false };
+        bool destroyed{ false };
+
+        std::vector<RelayComponent> componentList;
+        std::vector<int> removedList;
+    };
+
+    class RelayWorld final
+    {
+
+    public:
+
+        void Apply(const Snapshot& snapshot)
+        {
+            const std::span<const std::uint8_t> blob(snapshot.operationBlob.data(), snapshot.operationBlob.size());
+
+            std::size_t offset = 0;
+
+            for (std::uint32_t i = 0; i < snapshot.header.operationCount; ++i)
+            {
+                if (offset + 5 > blob.size())
+                    break;
+
+                const OpCode code = static_cast<OpCode>(blob[offset]);
+
+                offset += sizeof(std::uint8_t);
+
+                const std::uint32_t length = CommonNetwork::ReadTrivial<std::uint32_t>(blob, offset);
+
+                if (offset + length > blob.size())
+                    break;
+
+                const std::span<const std::uint8_t> slice(blob.data() + offset, length);
+
+                offset += length;
+
+                ApplyOperation(code, slice);
+            }
+        }
+
+        [[nodiscard]]
+        Snapshot BuildLateJoinSnapshot() const
+        {
+            Snapshot snapshot{};
+
+            snapshot.header.operationCount = 0;
+            snapshot.header.ack = 0;
+            snapshot.header.route = Route::ServerBroadcast;
+            snapshot.header.origin = 0;
+
+            for (const auto& [path, entity] : entityMap)
+            {
+                if (entity.destroyed)
+                {
+                    PushOp(snapshot, OpDestroy{ path });
+                    continue;
+                }
+
+                if (entity.spawn.has_value())
+                    PushOp(snapshot, entity.spawn.value());
+                else if (!entity.implicit)
+                    PushOp(snapshot, entity.create);
+
+                for (const int componentType : entity.removedList)
+                    PushOp(snapshot, OpRemoveComponent{ path, componentType });
+
+                for (const auto& component : entity.componentList)
+                {
+                    if (!component.blob.empty())
+                        PushOp(snapshot, OpAddComponent{ path, component.componentType, component.blob });
+
+                    for (const auto& [fieldMask, value] : component.patchList)
+                        PushOp(snapshot, OpSetField{ path, component.componentType, fieldMask, value });
+                }
+            }
+
+            return snapshot;
+        }
+
+        void Clear()
+        {
+            entityMap.clear();
+
+            NetworkEntityTable::GetInstance().Clear();
+        }
+
+        [[nodiscard]]
+        std::size_t GetEntityCount() const
+        {
+            return entityMap.size();
+        }
+
+    private:
+
+        void ApplyOperation(const OpCode code, const std::span<const std::uint8_t> slice)
+        {
+            switch (code)
+            {
+
+            case OpCode::Create:
+            {
+                auto operation = std::any_cast<OpCreate>(DataConversion<OpCreate>::Decode(slice));
+
+                NetworkEntityTable::GetInstance().Bind(operation.entityId, operation.path);
+
+                entityMap[operation.path] = RelayEntity{ std::move(operation), std::nullopt };
+
+                break;
+            }
+
+            case OpCode::Spawn:
+            {
+                auto operation = std::any_cast<OpSpawn>(DataConversion<OpSpawn>::Decode(slice));
+
+                NetworkEntityTable::GetInstance().Bind(operation.entityId, operation.path);
+
+                const std::string path = operation.path;
+
+                entityMap[path] = RelayEntity{ {}, std::move(operation) };
+
+                break;
+            }
+
+            case OpCode::Destroy:
+            {
+                auto operation = std::any_cast<OpDestroy>(DataConversion<OpDestroy>::Decode(slice));
+
+                if (!NetworkEntityTable::GetInstance().Resolve(operation.entityId, operation.path))
+                    break;
+
+                const std::string prefix = operation.path + ".";
+
+                NetworkEntityTable::GetInstance().ForgetPath(operation.path);
+
+                entityMap.erase(operation.path);
+
+                for (auto iterator = entityMap.lower_bound(prefix); iterator != entityMap.end() && iterator->first.starts_with(prefix); )
+                    iterator = entityMap.erase(iterator);
+
+                if (HasSpawnedAncestor(operation.path))
+                    entityMap[operation.path] = RelayEntity{ .implicit = true, .destroyed = true };
+
+                break;
+            }
+
+            case OpCode::AddComponent:
+            {
+                auto operation = std::any_cast<OpAddComponent>(DataConversion<OpAddComponent>::Decode(slice));
+
+                if (!NetworkEntityTable::GetInstance().Resolve(operation.entityId, operation.path))
+                    break;
+
+                if (RelayComponent* component = FindComponent(operation.path, operation.componentType, true))
+                {
+                    component->blob = std::move(operation.blob);
+                    component->patchList.clear();
+                }
+
+                break;
+            }
+
+            case OpCode::RemoveComponent:
+            {
+                auto operation = std::any_cast<OpRemoveComponent>(DataConversion<OpRemoveComponent>::Decode(slice));
+
+                if (!NetworkEntityTable::GetInstance().Resolve(operation.entityId, operation.path))
+                    break;
+
+                RelayEntity* entity = FindEntity(operation.path);
+
+                if (entity == nullptr)
+                    break;
+
+                std::erase_if(entity->componentList, [&operation](const RelayComponent& component) { return component.componentType == operation.componentType; });
+
+                if (IsPrefabInstance(*entity) && std::ranges::find(entity->removedList, operation.componentType) == entity->removedList.end())
+                    entity->removedList.push_back(operation.componentType);
+
+                break;
+            }
+
+            case OpCode::SetField:
+            {
+                auto operation = std::any_cast<OpSetField>(DataConversion<OpSetField>::Decode(slice));
+
+                if (!NetworkEntityTable::GetInstance().Resolve(operation.entityId, operation.path))
+                    break;
+
+                RelayComponent* component = FindComponent(operation.path, operation.componentType, false);
+
+                if (component == nullptr)
+                    break;
+
+                if (operation.fieldMask == 0)
+                {
+                    component->patchList.clear();
+                    component->patchList.push_back({ 0, std::move(operation.blob) });
+
+                    break;
+                }
+
+                std::erase_if(component->patchList, [&operation](const RelayFieldPatch& patch) { return patch.fieldMask != 0 && (patch.fieldMask & ~operation.fieldMask) == 0; });
+
+                component->patchList.push_back({ operation.fieldMask, std::move(operation.blob) });
+
+                break;
+            }
+
+            default:
+                break;
+            }
+        }
+
+        RelayComponent* FindComponent(const std::string& path, const int componentType, const bool create)
+        {
+            RelayEntity* entity = FindEntity(path);
+
+            if (entity == nullptr)
+                return nullptr;
+
+            auto& componentList = entity->componentList;
+
+            const auto iterator = std::ranges::find(componentList, componentType, &RelayComponent::componentType);
+
+            if (iterator != componentList.end())
+                return &*iterator;
+
+            if (!create && !IsPrefabInstance(*entity))
+                return nullptr;
+
+            std::erase(entity->removedList, componentType);
+
+            componentList.push_back({ componentType, {}, {} });
+
+            return &componentList.back();
+        }
+
+        RelayEntity* FindEntity(const std::string& path)
+        {
+            if (const auto hit = entityMap.find(path); hit != entityMap.end())
+                return hit->second.destroyed ? nullptr : &hit->second;
+
+            if (!HasSpawnedAncestor(path))
+                return nullptr;
+
+            RelayEntity& entity = entityMap[path];
+
+            entity.implicit = true;
+
+            return &entity;
+        }
+
+        [[nodiscard]]
+        bool HasSpawnedAncestor(const std::string& path) const
+        {
+            for (std::size_t dotPosition = path.rfind('.'); dotPosition != std::string::npos; dotPosition = dotPosition == 0 ? std::string::npos : path.rfind('.', dotPosition - 1))
+            {
+                const auto hit = entityMap.find(path.substr(0, dotPosition));
+
+                if (hit == entityMap.end())
+                    continue;
+
+                if (hit->second.destroyed)
+                    return false;
+
+                if (hit->second.spawn.has_value())
+                    return true;
+            }
+
+            return false;
+        }
+
+        static bool IsPrefabInstance(const RelayEntity& entity)
+        {
+            return entity.spawn.has_value() || entity.implicit;
+        }
+
+        template <typename Op>
+        static void PushOp(Snapshot& snapshot, const Op& operation)
+        {
+            std::vector<std::uint8_t> temporary;
+
+            DataConversion<Op>::Encode(operation, temporary);
+
+            CommonNetwork::WriteTrivial(snapshot.operationBlob, static_cast<std::uint8_t>(Op::Code));
+            CommonNetwork::WriteTrivial(snapshot.operationBlob, static_cast<std::uint32_t>(temporary.size()));
+            CommonNetwork::WriteRaw(snapshot.operationBlob, temporary.data(), temporary.size());
+
+            ++snapshot.header.operationCount;
+        }
+
+        std::map<std::string, RelayEntity> entityMap;
+
+    };
+}
\ No newline at end of file
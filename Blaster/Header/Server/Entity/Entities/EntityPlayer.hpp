@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include "Client/Core/InputManager.hpp"
 #include "Client/Render/Vertices/FatVertex.hpp"
 #include "Client/Render/Camera.hpp"
@@ -7,7 +8,9 @@
 #include "Client/Render/ShaderManager.hpp"
 #include "Client/Render/TextureManager.hpp"
 #include "Independent/ComponentRegistry.hpp"
+#include "Independent/ECS/DescribedCodec.hpp"
 #include "Independent/ECS/GameObject.hpp"
+#include "Independent/ECS/Prefab.hpp"
 #include "Independent/Utility/Time.hpp"
 #include "Independent/Thread/MainThreadExecutor.hpp"
 #include "Independent/Physics/CharacterController.hpp"
@@ -26,6 +29,15 @@ namespace Blaster::Server::Entity::Entities
 
     public:
 
+        static constexpr bool UsesDescribedCodec = true;
+
+        static constexpr std::array FieldAttributes
+        {
+            FieldAttribute::Quantize("CurrentHealth", 0.0f, 10000.0f, 0.25f),
+            FieldAttribute::Quantize("MaximumHealth", 0.0f, 10000.0f, 0.25f),
+            FieldAttribute::Skip("MouseSensitivity")
+        };
+
         enum class Team
         {
             Red,
@@ -77,6 +89,17 @@ namespace Blaster::Server::Entity::Entities
             UpdateMovement();
         }
 
+        void SetTeam(const Team& team)
+        {
+            this->team = team;
+        }
+
+        [[nodiscard]]
+        Team GetTeam() const
+        {
+            return team;
+        }
+
         static std::shared_ptr<EntityPlayer> Create(const Team& team)
         {
             std::shared_ptr<EntityPlayer> result(new EntityPlayer());
@@ -86,6 +109,14 @@ namespace Blaster::Server::Entity::Entities
             return result;
         }
 
+        static void RegisterPrefabs()
+        {
+            PrefabManager::GetInstance().Register(Prefab::Create("blaster.player",
+            {
+                { "", { Transform3d::Create({ 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f }), EntityPlayer::Create(Team::Red), CharacterController::Create(1.45f, 8.0f) } }
+            }));
+        }
+
     private:
 
         EntityPlayer()
@@ -108,20 +139,6 @@ namespace Blaster::Server::Entity::Entities
         friend class boost::serialization::access;
         friend class Blaster::Independent::ECS::ComponentFactory;
 
-        template <typename Archive>
-        void serialize(Archive& archive, const unsigned)
-        {
-            archive & boost::serialization::base_object<Component>(*this);
-
-            archive & boost::serialization::make_nvp("registryName", RegistryName);
-            archive & boost::serialization::make_nvp("currentHealth", CurrentHealth);
-            archive & boost::serialization::make_nvp("maximumHealth", MaximumHealth);
-            archive & boost::serialization::make_nvp("movementSpeed", MovementSpeed);
-            archive & boost::serialization::make_nvp("runningMultiplier", RunningMultiplier);
-            archive & boost::serialization::make_nvp("jumpHeight", JumpHeight);
-            archive & boost::serialization::make_nvp("canJump", CanJump);
-        }
-
         void UpdateMouselook() const
         {
             if (InputManager::GetInstance().GetKeyState(KeyCode::ESCAPE, KeyState::PRESSED))
@@ -200,7 +217,7 @@ namespace Blaster::Server::Entity::Entities
 
         BUILDABLE_PROPERTY(MouseSensitivity, float, EntityPlayer)
 
-        DESCRIBE_AND_REGISTER(EntityPlayer, (EntityBase<EntityPlayer>), (), (), (MouseSensitivity))
+        DESCRIBE_AND_REGISTER(EntityPlayer, (EntityBase<EntityPlayer>), (), (), (team, MouseSensitivity))
 
     };
 }
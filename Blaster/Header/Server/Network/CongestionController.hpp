@@ -0,0 +1,184 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <mutex>
+#include <unordered_map>
+#include "Server/Network/ServerNetwork.hpp"
+
+namespace Blaster::Server::Network
+{
+    struct ClientLinkState
+    {
+        std::size_t budget{ 0 };
+
+        std::uint64_t lastDeliveredBytes{ 0 };
+        std::chrono::steady_clock::time_point lastTick{};
+
+        double deliveryRate{ 0.0 };
+
+        std::optional<std::chrono::steady_clock::duration> minimumRtt{};
+        std::optional<std::chrono::steady_clock::duration> smoothedRtt{};
+
+        bool congested{ false };
+
+        std::uint64_t lastAck{ 0 };
+
+        std::unordered_map<std::uint64_t, std::chrono::steady_clock::time_point> sentTimeMap{};
+    };
+
+    class CongestionController final
+    {
+
+    public:
+
+        CongestionController(const CongestionController&) = delete;
+        CongestionController(CongestionController&&) = delete;
+        CongestionController& operator=(const CongestionController&) = delete;
+        CongestionController& operator=(CongestionController&&) = delete;
+
+        std::size_t BeginTick(const NetworkId id)
+        {
+            const auto statistics = ServerNetwork::GetInstance().GetLinkStatistics(id);
+
+            if (!statistics.has_value())
+                return std::numeric_limits<std::size_t>::max();
+
+            const auto now = std::chrono::steady_clock::now();
+
+            std::lock_guard guard(mutex);
+
+            auto& state = GetState(id);
+
+            if (state.lastTick != std::chrono::steady_clock::time_point{})
+            {
+                const double elapsed = std::chrono::duration<double>(now - state.lastTick).count();
+
+                if (elapsed > 0.0)
+                {
+                    const double sample = static_cast<double>(statistics->deliveredBytes - state.lastDeliveredBytes) / elapsed;
+
+                    state.deliveryRate = state.deliveryRate == 0.0 ? sample : state.deliveryRate * 0.875 + sample * 0.125;
+                }
+
+                const bool standingQueue = statistics->queuedBytes > state.budget;
+
+                if (standingQueue || state.congested)
+                {
+                    state.budget = std::max(kMinimumBudget, static_cast<std::size_t>(static_cast<double>(state.budget) * kDecreaseFactor));
+
+                    if (standingQueue && state.deliveryRate > 0.0)
+                        state.budget = std::max(kMinimumBudget, std::min(state.budget, static_cast<std::size_t>(state.deliveryRate * elapsed * 2.0)));
+                }
+                else
+                    state.budget = std::min(kMaximumBudget, state.budget + kAdditiveStep);
+            }
+
+            state.congested = false;
+            state.lastTick = now;
+            state.lastDeliveredBytes = statistics->deliveredBytes;
+
+            if (statistics->queuedBytes >= state.budget)
+                return 0;
+
+            return state.budget - statistics->queuedBytes;
+        }
+
+        void OnSent(const NetworkId id, const std::uint64_t sequence)
+        {
+            std::lock_guard guard(mutex);
+
+            auto& state = GetState(id);
+
+            if (state.sentTimeMap.size() >= kSentTimeLimit)
+                state.sentTimeMap.clear();
+
+            state.sentTimeMap[sequence] = std::chrono::steady_clock::now();
+        }
+
+        void OnAck(const NetworkId id, const std::uint64_t ack)
+        {
+            const auto now = std::chrono::steady_clock::now();
+
+            std::lock_guard guard(mutex);
+
+            const auto hit = stateMap.find(id);
+
+            if (hit == stateMap.end())
+                return;
+
+            auto& state = hit->second;
+
+            if (ack <= state.lastAck)
+                return;
+
+            state.lastAck = ack;
+
+            const auto sent = state.sentTimeMap.find(ack);
+
+            if (sent != state.sentTimeMap.end())
+            {
+                const auto sample = now - sent->second;
+
+                state.minimumRtt = state.minimumRtt.has_value() ? std::min(state.minimumRtt.value(), sample) : sample;
+                state.smoothedRtt = state.smoothedRtt.has_value() ? (state.smoothedRtt.value() * 7 + sample) / 8 : sample;
+
+                if (state.smoothedRtt.value() > state.minimumRtt.value() * 2 + kRttSlack)
+                    state.congested = true;
+            }
+
+            std::erase_if(state.sentTimeMap, [ack](const auto& entry) { return entry.first <= ack; });
+        }
+
+        void ForgetClient(const NetworkId id)
+        {
+            std::lock_guard guard(mutex);
+
+            stateMap.erase(id);
+        }
+
+        static CongestionController& GetInstance()
+        {
+            std::call_once(initializationFlag, [&]()
+            {
+                instance = std::unique_ptr<CongestionController>(new CongestionController());
+            });
+
+            return *instance;
+        }
+
+    private:
+
+        CongestionController() = default;
+
+        ClientLinkState& GetState(const NetworkId id)
+        {
+            const auto [iterator, inserted] = stateMap.try_emplace(id);
+
+            if (inserted)
+                iterator->second.budget = kInitialBudget;
+
+            return iterator->second;
+        }
+
+        static constexpr std::size_t kInitialBudget = 16 * 1024;
+        static constexpr std::size_t kMinimumBudget = 2 * 1024;
+        static constexpr std::size_t kMaximumBudget = 512 * 1024;
+        static constexpr std::size_t kAdditiveStep = 2 * 1024;
+        static constexpr double kDecreaseFactor = 0.5;
+
+        static constexpr std::size_t kSentTimeLimit = 512;
+        static constexpr std::chrono::milliseconds kRttSlack{ 20 };
+
+        std::unordered_map<NetworkId, ClientLinkState> stateMap{};
+        std::mutex mutex{};
+
+        static std::once_flag initializationFlag;
+        static std::unique_ptr<CongestionController> instance;
+
+    };
+
+    std::once_flag CongestionController::initializationFlag;
+    std::unique_ptr<CongestionController> CongestionController::instance;
+}
\ No newline at end of file
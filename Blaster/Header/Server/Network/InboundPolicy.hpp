@@ -0,0 +1,141 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <unordered_map>
+#include "Independent/Network/CommonNetwork.hpp"
+
+using namespace Blaster::Independent::Network;
+
+namespace Blaster::Server::Network
+{
+    enum class ViolationAction : std::uint8_t
+    {
+        Drop,
+        Disconnect
+    };
+
+    struct BucketConfiguration
+    {
+        double ratePerSecond{ 0.0 };
+        double burst{ 0.0 };
+    };
+
+    struct InboundPolicy
+    {
+        std::size_t maximumPacketSize = 4 * 1024 * 1024;
+        std::uint32_t maximumOperationsPerSnapshot = 4096;
+
+        BucketConfiguration connectionPackets{ 240.0, 480.0 };
+        BucketConfiguration connectionBytes{ 2.0 * 1024 * 1024, 4.0 * 1024 * 1024 };
+
+        std::unordered_map<PacketType, BucketConfiguration> packetTypeMap
+        {
+            { PacketType::C2S_Snapshot, { 120.0, 240.0 } },
+            { PacketType::C2S_Rigidbody_Impulse, { 30.0, 60.0 } },
+            { PacketType::C2S_Rigidbody_SetVelocity, { 30.0, 60.0 } },
+            { PacketType::C2S_Rigidbody_SetTransform, { 30.0, 60.0 } },
+            { PacketType::C2S_CharacterController_Input, { 120.0, 240.0 } },
+            { PacketType::C2S_StringId, { 1.0, 2.0 } },
+            { PacketType::C2S_ResumeSession, { 1.0, 2.0 } },
+            { PacketType::C2S_ClaimHandoff, { 1.0, 2.0 } },
+            { PacketType::C2S_RelayHello, { 1.0, 2.0 } }
+        };
+
+        ViolationAction onRateExceeded = ViolationAction::Drop;
+        ViolationAction onMalformed = ViolationAction::Disconnect;
+
+        std::uint32_t disconnectAfterViolations = 500;
+    };
+
+    class TokenBucket final
+    {
+
+    public:
+
+        TokenBucket() = default;
+
+        explicit TokenBucket(const BucketConfiguration& configuration) : configuration(configuration), tokens(configuration.burst), lastRefill(std::chrono::steady_clock::now()) { }
+
+        bool TryConsume(const double cost)
+        {
+            if (configuration.ratePerSecond <= 0.0)
+                return true;
+
+            const auto now = std::chrono::steady_clock::now();
+
+            tokens = std::min(configuration.burst, tokens + std::chrono::duration<double>(now - lastRefill).count() * configuration.ratePerSecond);
+            lastRefill = now;
+
+            if (tokens < cost)
+                return false;
+
+            tokens -= cost;
+
+            return true;
+        }
+
+    private:
+
+        BucketConfiguration configuration{};
+
+        double tokens{ 0.0 };
+
+        std::chrono::steady_clock::time_point lastRefill{};
+
+    };
+
+    class InboundLimiter final
+    {
+
+    public:
+
+        explicit InboundLimiter(const InboundPolicy& policy) : packetBucket(policy.connectionPackets), byteBucket(policy.connectionBytes)
+        {
+            for (const auto& [type, configuration] : policy.packetTypeMap)
+                packetTypeBucketMap.emplace(type, TokenBucket(configuration));
+        }
+
+        bool Admit(const PacketType type, const std::size_t size)
+        {
+            if (!packetBucket.TryConsume(1.0) || !byteBucket.TryConsume(static_cast<double>(size)))
+                return false;
+
+            if (const auto iterator = packetTypeBucketMap.find(type); iterator != packetTypeBucketMap.end())
+                return iterator->second.TryConsume(1.0);
+
+            return true;
+        }
+
+        std::uint32_t CountViolation(const std::string& reason)
+        {
+            ++violationCountMap[reason];
+
+            return ++violationCount;
+        }
+
+        [[nodiscard]]
+        std::uint32_t GetViolationCount() const
+        {
+            return violationCount;
+        }
+
+        [[nodiscard]]
+        const std::unordered_map<std::string, std::uint32_t>& GetViolationCountMap() const
+        {
+            return violationCountMap;
+        }
+
+    private:
+
+        TokenBucket packetBucket;
+        TokenBucket byteBucket;
+
+        std::unordered_map<PacketType, TokenBucket> packetTypeBucketMap;
+
+        std::uint32_t violationCount{ 0 };
+        std::unordered_map<std::string, std::uint32_t> violationCountMap;
+
+    };
+}
\ No newline at end of file
@@ -0,0 +1,297 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "Independent/Math/Vector.hpp"
+#include "Independent/Network/CommonNetwork.hpp"
+
+using namespace Blaster::Independent::Math;
+using namespace Blaster::Independent::Network;
+
+namespace Blaster::Server::Network
+{
+    struct InterestChange
+    {
+        std::vector<std::string> enteredList;
+        std::vector<std::string> leftList;
+    };
+
+    class InterestGrid final
+    {
+
+    public:
+
+        InterestGrid(const InterestGrid&) = delete;
+        InterestGrid(InterestGrid&&) = delete;
+        InterestGrid& operator=(const InterestGrid&) = delete;
+        InterestGrid& operator=(InterestGrid&&) = delete;
+
+        void Configure(const float cellSize, const float enterRadius, const float leaveRadius)
+        {
+            std::lock_guard guard(mutex);
+
+            this->cellSize = cellSize;
+            this->enterRadius = enterRadius;
+            this->leaveRadius = std::max(enterRadius, leaveRadius);
+
+            std::unordered_map<std::string, Vector<float, 3>> positionMap;
+
+            for (const auto& [path, entry] : entryMap)
+                positionMap.emplace(path, entry.position);
+
+            entryMap.clear();
+            cellMap.clear();
+
+            for (const auto& [path, position] : positionMap)
+                UpdateLocked(path, position);
+        }
+
+        void Update(const std::string& rootPath, const Vector<float, 3>& position)
+        {
+            std::lock_guard guard(mutex);
+
+            UpdateLocked(rootPath, position);
+        }
+
+        void Remove(const std::string& rootPath)
+        {
+            std::lock_guard guard(mutex);
+
+            const auto hit = entryMap.find(rootPath);
+
+            if (hit == entryMap.end())
+                return;
+
+            EraseFromCell(hit->second.cell, rootPath);
+
+            entryMap.erase(hit);
+        }
+
+        void SetFocus(const NetworkId id, const std::string& rootPath)
+        {
+            std::lock_guard guard(mutex);
+
+            clientMap[id].focus = rootPath;
+        }
+
+        void ResetClient(const NetworkId id)
+        {
+            std::lock_guard guard(mutex);
+
+            if (const auto hit = clientMap.find(id); hit != clientMap.end())
+                hit->second.visibleSet.clear();
+        }
+
+        void ForgetClient(const NetworkId id)
+        {
+            std::lock_guard guard(mutex);
+
+            clientMap.erase(id);
+        }
+
+        InterestChange Refresh(const NetworkId id)
+        {
+            std::lock_guard guard(mutex);
+
+            InterestChange result;
+
+            const auto clientIterator = clientMap.find(id);
+
+            if (clientIterator == clientMap.end())
+                return result;
+
+            ClientInterest& client = clientIterator->second;
+
+            const auto focusIterator = entryMap.find(client.focus);
+
+            if (focusIterator == entryMap.end())
+                return result;
+
+            const Vector<float, 3> center = focusIterator->second.position;
+
+            for (auto iterator = client.visibleSet.begin(); iterator != client.visibleSet.end(); )
+            {
+                const auto hit = entryMap.find(*iterator);
+
+                if (hit != entryMap.end() && (*iterator == client.focus || DistanceSquared(hit->second.position, center) <= leaveRadius * leaveRadius))
+                {
+                    ++iterator;
+                    continue;
+                }
+
+                result.leftList.push_back(*iterator);
+
+                iterator = client.visibleSet.erase(iterator);
+            }
+
+            const std::int64_t reach = static_cast<std::int64_t>(std::ceil(enterRadius / cellSize));
+            const std::int64_t centerX = CellCoordinate(center[0]);
+            const std::int64_t centerZ = CellCoordinate(center[2]);
+
+            for (std::int64_t x = centerX - reach; x <= centerX + reach; ++x)
+            {
+                for (std::int64_t z = centerZ - reach; z <= centerZ + reach; ++z)
+                {
+                    const auto cell = cellMap.find(MakeCellKey(x, z));
+
+                    if (cell == cellMap.end())
+                        continue;
+
+                    for (const std::string& path : cell->second)
+                    {
+                        if (client.visibleSet.contains(path))
+                            continue;
+
+                        if (path != client.focus && DistanceSquared(entryMap.at(path).position, center) > enterRadius * enterRadius)
+                            continue;
+
+                        client.visibleSet.insert(path);
+                        result.enteredList.push_back(path);
+                    }
+                }
+            }
+
+            if (!client.visibleSet.contains(client.focus))
+            {
+                client.visibleSet.insert(client.focus);
+                result.enteredList.push_back(client.focus);
+            }
+
+            return result;
+        }
+
+        [[nodiscard]]
+        bool IsInterested(const NetworkId id, const std::string& rootPath) const
+        {
+            std::lock_guard guard(mutex);
+
+            const auto hit = clientMap.find(id);
+
+            if (hit == clientMap.end() || !entryMap.contains(hit->second.focus))
+                return true;
+
+            return rootPath == hit->second.focus || hit->second.visibleSet.contains(rootPath);
+        }
+
+        [[nodiscard]]
+        std::optional<float> GetDistance(const NetworkId id, const std::string& rootPath) const
+        {
+            std::lock_guard guard(mutex);
+
+            const auto client = clientMap.find(id);
+
+            if (client == clientMap.end())
+                return std::nullopt;
+
+            const auto focus = entryMap.find(client->second.focus);
+            const auto target = entryMap.find(rootPath);
+
+            if (focus == entryMap.end() || target == entryMap.end())
+                return std::nullopt;
+
+            return std::sqrt(DistanceSquared(focus->second.position, target->second.position));
+        }
+
+        static InterestGrid& GetInstance()
+        {
+            std::call_once(initializationFlag, [&]()
+            {
+                instance = std::unique_ptr<InterestGrid>(new InterestGrid());
+            });
+
+            return *instance;
+        }
+
+    private:
+
+        struct Entry
+        {
+            Vector<float, 3> position;
+
+            std::uint64_t cell{ 0 };
+        };
+
+        struct ClientInterest
+        {
+            std::string focus;
+
+            std::unordered_set<std::string> visibleSet;
+        };
+
+        InterestGrid() = default;
+
+        void UpdateLocked(const std::string& rootPath, const Vector<float, 3>& position)
+        {
+            const std::uint64_t cell = MakeCellKey(CellCoordinate(position[0]), CellCoordinate(position[2]));
+
+            const auto [iterator, inserted] = entryMap.try_emplace(rootPath, Entry{ position, cell });
+
+            if (!inserted)
+            {
+                iterator->second.position = position;
+
+                if (iterator->second.cell == cell)
+                    return;
+
+                EraseFromCell(iterator->second.cell, rootPath);
+
+                iterator->second.cell = cell;
+            }
+
+            cellMap[cell].insert(rootPath);
+        }
+
+        void EraseFromCell(const std::uint64_t cell, const std::string& rootPath)
+        {
+            const auto hit = cellMap.find(cell);
+
+            if (hit == cellMap.end())
+                return;
+
+            hit->second.erase(rootPath);
+
+            if (hit->second.empty())
+                cellMap.erase(hit);
+        }
+
+        [[nodiscard]]
+        std::int64_t CellCoordinate(const float value) const
+        {
+            return static_cast<std::int64_t>(std::floor(value / cellSize));
+        }
+
+        static std::uint64_t MakeCellKey(const std::int64_t x, const std::int64_t z)
+        {
+            return static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32 | static_cast<std::uint32_t>(z);
+        }
+
+        static float DistanceSquared(const Vector<float, 3>& a, const Vector<float, 3>& b)
+        {
+            return Vector<float, 3>::LengthSquared(a - b);
+        }
+
+        float cellSize{ 256.0f };
+        float enterRadius{ 1024.0f };
+        float leaveRadius{ 1152.0f };
+
+        std::unordered_map<std::string, Entry> entryMap;
+        std::unordered_map<std::uint64_t, std::unordered_set<std::string>> cellMap;
+
+        std::unordered_map<NetworkId, ClientInterest> clientMap;
+
+        mutable std::mutex mutex;
+
+        static std::once_flag initializationFlag;
+        static std::unique_ptr<InterestGrid> instance;
+
+    };
+
+    std::once_flag InterestGrid::initializationFlag;
+    std::unique_ptr<InterestGrid> InterestGrid::instance;
+}
\ No newline at end of file
@@ -3,20 +3,32 @@
 #include <memory>
 #include <mutex>
 #include <array>
+#include <atomic>
 #include <deque>
 #include <queue>
 #include <ranges>
+#include <shared_mutex>
 #include <thread>
 #include <iostream>
 #include <boost/asio.hpp>
 #include "Independent/ECS/IGameObjectSynchronization.hpp"
 #include "Independent/Network/CommonNetwork.hpp"
+#include "Independent/Network/SessionTicket.hpp"
+#include "Independent/Network/ZoneHandoff.hpp"
+#include "Independent/Utility/SecureRandom.hpp"
+#include "Server/Network/InboundPolicy.hpp"
 
 using namespace Blaster::Independent::ECS;
 using namespace Blaster::Independent::Network;
 
 namespace Blaster::Server::Network
 {
+    struct LinkStatistics
+    {
+        std::size_t queuedBytes{ 0 };
+        std::uint64_t deliveredBytes{ 0 };
+    };
+
     class ServerNetwork final
     {
 
@@ -39,12 +51,22 @@ namespace Blaster::Server::Network
             NetworkId id{};
             std::string stringId = "!";
 
+            std::uint64_t resumeToken{};
+
+            bool redirected{ false };
+            std::atomic<bool> relay{ false };
+
             std::array<std::uint8_t, 512> readBuffer{};
             std::vector<std::uint8_t> inbox;
 
+            std::atomic<std::size_t> queuedBytes{ 0 };
+            std::atomic<std::uint64_t> deliveredBytes{ 0 };
+
             boost::asio::steady_timer disconnectTimer{ socket.get_executor() };
 
-            explicit ClientReference(TcpProtocol::socket sock) : socket(std::move(sock)), strand(boost::asio::make_strand(socket.get_executor())) { }
+            InboundLimiter limiter;
+
+            ClientReference(TcpProtocol::socket sock, const InboundPolicy& policy) : socket(std::move(sock)), strand(boost::asio::make_strand(socket.get_executor())), limiter(policy) { }
         };
 
         void Initialize(const std::uint16_t port)
@@ -60,6 +82,26 @@ namespace Blaster::Server::Network
             running  = true;
         }
 
+        void SetInboundPolicy(const InboundPolicy& policy)
+        {
+            inboundPolicy = policy;
+        }
+
+        const InboundPolicy& GetInboundPolicy() const
+        {
+            return inboundPolicy;
+        }
+
+        void ReportViolation(const NetworkId id, const std::string& reason)
+        {
+            const auto client = FindClient(id);
+
+            if (!client)
+                return;
+
+            ReportViolation(client, reason, inboundPolicy.onMalformed);
+        }
+
         void RegisterReceiver(const PacketType type, std::function<void(NetworkId, std::vector<std::uint8_t>)> function)
         {
             packetHandlerMap[type].push_back(std::move(function));
@@ -68,14 +110,20 @@ namespace Blaster::Server::Network
         template <typename... Args> requires DataConvertible<Args...>
         void SendTo(const NetworkId id, const PacketType type, Args&&... args)
         {
-            const auto hit = clientMap.find(id);
+            SendTo(FindClient(id), type, std::forward<Args>(args)...);
+        }
 
-            if (hit == clientMap.end())
+        template <typename... Args> requires DataConvertible<Args...>
+        void SendTo(const std::shared_ptr<ClientReference>& client, const PacketType type, Args&&... args)
+        {
+            if (!client)
                 return;
 
             auto buf = std::make_shared<std::vector<std::uint8_t>>(CommonNetwork::BuildPacket(type, 0, std::forward<Args>(args)...));
 
-            boost::asio::post(hit->second->strand, [this, client = hit->second, buf]()
+            client->queuedBytes += buf->size();
+
+            boost::asio::post(client->strand, [this, client, buf]()
             {
                 client->writeQueue.push_back(buf);
 
@@ -86,14 +134,16 @@ namespace Blaster::Server::Network
         
         void ForwardTo(const NetworkId id, const PacketType type, std::vector<std::uint8_t> dataIn)
         {
-            const auto hit = clientMap.find(id);
+            const auto client = FindClient(id);
 
-            if (hit == clientMap.end())
+            if (!client)
                 return;
 
             auto data = std::make_shared<std::vector<std::uint8_t>>(dataIn);
 
-            boost::asio::post(hit->second->strand, [this, client = hit->second, data]()
+            client->queuedBytes += data->size();
+
+            boost::asio::post(client->strand, [this, client, data]()
                 {
                     client->writeQueue.push_back(data);
 
@@ -105,7 +155,7 @@ namespace Blaster::Server::Network
         template <typename... Args> requires DataConvertible<Args...>
         void Broadcast(const PacketType type, const std::optional<NetworkId> except, Args&&... args)
         {
-            for (const auto& id : clientMap | std::views::keys)
+            for (const auto& id : GetConnectedClients())
             {
                 if (except.has_value() && id == except.value())
                     continue;
@@ -121,32 +171,87 @@ namespace Blaster::Server::Network
 
         bool HasClient(const NetworkId id) const
         {
+            std::shared_lock guard(clientMutex);
+
             return clientMap.contains(id);
         }
 
+        bool IsRelay(const NetworkId id) const
+        {
+            const auto client = FindClient(id);
+
+            return client && client->relay;
+        }
+
         void AddOnClientDisconnectedCallback(const std::function<void(std::shared_ptr<ClientReference>)>& callback)
         {
             onClientDisconnectedCallbackList.push_back(callback);
         }
 
+        void AddOnClientResumedCallback(const std::function<void(NetworkId, NetworkId, std::uint64_t)>& callback)
+        {
+            onClientResumedCallbackList.push_back(callback);
+        }
+
         std::optional<std::shared_ptr<ClientReference>> GetClient(const NetworkId id)
         {
-            if (!clientMap.contains(id))
+            auto client = FindClient(id);
+
+            if (!client)
             {
                 std::cerr << "Client map doesn't contain client id '" << id << "'!";
                 return std::nullopt;
             }
 
-            return std::make_optional(clientMap[id]);
+            return std::make_optional(std::move(client));
+        }
+
+        std::vector<std::shared_ptr<ClientReference>> GetClientHandles(const std::vector<NetworkId>& idList) const
+        {
+            std::shared_lock guard(clientMutex);
+
+            std::vector<std::shared_ptr<ClientReference>> result;
+
+            result.reserve(idList.size());
+
+            for (const NetworkId id : idList)
+            {
+                const auto hit = clientMap.find(id);
+
+                result.push_back(hit == clientMap.end() ? nullptr : hit->second);
+            }
+
+            return result;
         }
 
         std::vector<NetworkId> GetConnectedClients() const
         {
+            std::shared_lock guard(clientMutex);
+
             auto result = clientMap | std::views::keys;
 
             return { result.begin(), result.end() };
         }
 
+        std::optional<LinkStatistics> GetLinkStatistics(const NetworkId id) const
+        {
+            const auto client = FindClient(id);
+
+            if (!client)
+                return std::nullopt;
+
+            return LinkStatistics{ client->queuedBytes.load(), client->deliveredBytes.load() };
+        }
+
+        std::vector<NetworkId> GetParkedClients() const
+        {
+            std::shared_lock guard(clientMutex);
+
+            auto result = parkedSessionMap | std::views::keys;
+
+            return { result.begin(), result.end() };
+        }
+
         auto& GetIoContext()
         {
             return ioContext;
@@ -162,13 +267,27 @@ namespace Blaster::Server::Network
             if (ioThread.joinable())
                 ioThread.join();
 
-            for (auto& client : clientMap | std::views::values)
+            std::unordered_map<NetworkId, std::shared_ptr<ClientReference>> closingClientMap;
+            std::unordered_map<NetworkId, std::shared_ptr<ParkedSession>> closingSessionMap;
+
+            {
+                std::unique_lock guard(clientMutex);
+
+                closingClientMap.swap(clientMap);
+                closingSessionMap.swap(parkedSessionMap);
+            }
+
+            for (auto& client : closingClientMap | std::views::values)
             {
                 for (auto& callback : onClientDisconnectedCallbackList)
                     callback(client);
             }
 
-            clientMap.clear();
+            for (auto& session : closingSessionMap | std::views::values)
+            {
+                for (auto& callback : onClientDisconnectedCallbackList)
+                    callback(session->client);
+            }
 
             running = false;
         }
@@ -185,12 +304,33 @@ namespace Blaster::Server::Network
 
     private:
 
+        struct ParkedSession
+        {
+            std::shared_ptr<ClientReference> client;
+
+            boost::asio::steady_timer graceTimer;
+
+            ParkedSession(std::shared_ptr<ClientReference> client, boost::asio::io_context& context) : client(std::move(client)), graceTimer(context) { }
+        };
+
         ServerNetwork() = default;
 
+        std::shared_ptr<ClientReference> FindClient(const NetworkId id) const
+        {
+            std::shared_lock guard(clientMutex);
+
+            const auto hit = clientMap.find(id);
+
+            return hit == clientMap.end() ? nullptr : hit->second;
+        }
+
         void StartWrite(const std::shared_ptr<ClientReference>& client)
         {
-            boost::asio::async_write(client->socket, boost::asio::buffer(*client->writeQueue.front()), boost::asio::bind_executor(client->strand, [client, this](const boost::system::error_code& error, std::size_t)
+            boost::asio::async_write(client->socket, boost::asio::buffer(*client->writeQueue.front()), boost::asio::bind_executor(client->strand, [client, this](const boost::system::error_code& error, std::size_t written)
             {
+                client->queuedBytes -= client->writeQueue.front()->size();
+                client->deliveredBytes += written;
+
                 client->writeQueue.pop_front();
 
                 if (error)
@@ -217,14 +357,23 @@ namespace Blaster::Server::Network
                     {
                         socket.set_option(TcpProtocol::no_delay(true));
 
-                        const auto client  = std::make_shared<ClientReference>(ClientReference{std::move(socket)});
+                        const auto client  = std::make_shared<ClientReference>(std::move(socket), inboundPolicy);
 
                         client->id = AcquireId();
-                        clientMap[client->id] = client;
+                        client->resumeToken = Blaster::Independent::Utility::SecureRandom::NextToken();
+
+                        {
+                            std::unique_lock guard(clientMutex);
+
+                            clientMap[client->id] = client;
+                        }
 
                         auto assign = std::make_shared<std::vector<std::uint8_t>>(CommonNetwork::BuildPacket(PacketType::S2C_AssignNetworkId, 0, client->id));
                         boost::asio::async_write(client->socket, boost::asio::buffer(*assign), [assign](auto, auto){ });
 
+                        auto ticket = std::make_shared<std::vector<std::uint8_t>>(CommonNetwork::BuildPacket(PacketType::S2C_SessionTicket, 0, SessionTicket{ client->id, client->resumeToken }));
+                        boost::asio::async_write(client->socket, boost::asio::buffer(*ticket), [ticket](auto, auto){ });
+
                         auto ask = std::make_shared<std::vector<std::uint8_t>>(CommonNetwork::BuildPacket(PacketType::S2C_RequestStringId, 0, 0));
 
                         boost::asio::async_write(client->socket, boost::asio::buffer(*ask), [ask](auto, auto){ });
@@ -255,18 +404,30 @@ namespace Blaster::Server::Network
                     {
                         auto* header = reinterpret_cast<const PacketHeader*>(client->inbox.data());
 
+                        if (header->size > inboundPolicy.maximumPacketSize)
+                        {
+                            ReportViolation(client, "oversized packet", ViolationAction::Disconnect);
+
+                            return;
+                        }
+
                         const std::size_t needed = sizeof(PacketHeader) + header->size;
 
                         if (client->inbox.size() < needed)
                             break;
 
-                        std::vector<std::uint8_t> payload;
+                        if (client->limiter.Admit(header->type, needed))
+                        {
+                            std::vector<std::uint8_t> payload;
 
-                        payload.resize(header->size);
+                            payload.resize(header->size);
 
-                        std::memcpy(payload.data(), client->inbox.data() + sizeof(PacketHeader), header->size);
+                            std::memcpy(payload.data(), client->inbox.data() + sizeof(PacketHeader), header->size);
 
-                        HandlePacket(client->id, *header, std::move(payload));
+                            HandlePacket(client->id, *header, std::move(payload));
+                        }
+                        else if (!ReportViolation(client, "rate exceeded", inboundPolicy.onRateExceeded))
+                            return;
 
                         client->inbox.erase(client->inbox.begin(), client->inbox.begin() + needed);
                     }
@@ -275,21 +436,169 @@ namespace Blaster::Server::Network
                 });
         }
 
-        void HandleDisconnect(const std::shared_ptr<ClientReference>& client)
+        bool ReportViolation(const std::shared_ptr<ClientReference>& client, const std::string& reason, const ViolationAction action)
         {
+            const std::uint32_t count = client->limiter.CountViolation(reason);
+
+            if (count == 1 || count % 100 == 0)
+                std::cerr << "Client '" << client->stringId << "' with id '" << client->id << "' violated inbound policy (" << reason << "), '" << count << "' violation(s) so far." << std::endl;
+
+            if (action == ViolationAction::Drop && count < inboundPolicy.disconnectAfterViolations)
+                return true;
+
+            DropClient(client, reason);
+
+            return false;
+        }
+
+        void DropClient(const std::shared_ptr<ClientReference>& client, const std::string& reason)
+        {
+            ErrorCode ignored;
+
+            client->socket.shutdown(boost::asio::socket_base::shutdown_both, ignored);
+            client->socket.close(ignored);
+
+            {
+                std::unique_lock guard(clientMutex);
+
+                const auto hit = clientMap.find(client->id);
+
+                if (hit == clientMap.end() || hit->second != client)
+                    return;
+
+                clientMap.erase(hit);
+            }
+
             for (auto& callback : onClientDisconnectedCallbackList)
                 callback(client);
 
-            client->socket.shutdown(boost::asio::socket_base::shutdown_both);
-            client->socket.close();
+            std::cout << "Client '" << client->stringId << "' with id '" << client->id << "' was disconnected (" << reason << ")." << std::endl;
+        }
+
+        void HandleDisconnect(const std::shared_ptr<ClientReference>& client)
+        {
+            ErrorCode ignored;
+
+            client->socket.shutdown(boost::asio::socket_base::shutdown_both, ignored);
+            client->socket.close(ignored);
+
+            const auto session = std::make_shared<ParkedSession>(client, ioContext);
+
+            {
+                std::unique_lock guard(clientMutex);
 
-            clientMap.erase(client->id);
+                const auto hit = clientMap.find(client->id);
+
+                if (hit == clientMap.end() || hit->second != client)
+                    return;
+
+                clientMap.erase(hit);
+
+                if (!client->redirected)
+                    parkedSessionMap[client->id] = session;
+            }
+
+            if (client->redirected)
+            {
+                for (auto& callback : onClientDisconnectedCallbackList)
+                    callback(client);
+
+                std::cout << "Client '" << client->stringId << "' with id '" << client->id << "' moved to another zone." << std::endl;
+
+                return;
+            }
+
+            session->graceTimer.expires_after(kResumeGracePeriod);
+            session->graceTimer.async_wait([this, id = client->id, wp = std::weak_ptr(session)](const ErrorCode& errorCode)
+                {
+                    if (errorCode == boost::asio::error::operation_aborted)
+                        return;
+
+                    const auto parked = wp.lock();
+
+                    if (!parked)
+                        return;
+
+                    {
+                        std::unique_lock guard(clientMutex);
 
-            std::cout << "Client '" << client->stringId << "' with id '" << client->id << "' has disconnected!" << std::endl;
+                        parkedSessionMap.erase(id);
+                    }
+
+                    for (auto& callback : onClientDisconnectedCallbackList)
+                        callback(parked->client);
+
+                    std::cout << "Client '" << parked->client->stringId << "' with id '" << id << "' has disconnected!" << std::endl;
+                });
+
+            std::cout << "Client '" << client->stringId << "' with id '" << client->id << "' lost connection; holding session for resume." << std::endl;
+        }
+
+        void HandleResume(const NetworkId from, std::vector<std::uint8_t>& data)
+        {
+            const auto anyList = CommonNetwork::DisassembleData(data);
+
+            if (anyList.empty())
+                return;
+
+            const auto request = std::any_cast<ResumeRequest>(anyList[0]);
+
+            std::shared_ptr<ClientReference> client;
+
+            {
+                std::unique_lock guard(clientMutex);
+
+                const auto parked = parkedSessionMap.find(request.id);
+                const auto current = clientMap.find(from);
+
+                if (current == clientMap.end())
+                    return;
+
+                if (parked != parkedSessionMap.end() && parked->second->client->resumeToken == request.token)
+                {
+                    client = current->second;
+
+                    const auto previous = parked->second->client;
+
+                    parked->second->graceTimer.cancel();
+                    parkedSessionMap.erase(parked);
+                    clientMap.erase(current);
+
+                    client->id = request.id;
+                    client->stringId = previous->stringId;
+                    client->resumeToken = previous->resumeToken;
+                    client->ownedGameObjectList = std::move(previous->ownedGameObjectList);
+
+                    clientMap[client->id] = client;
+                }
+            }
+
+            if (!client)
+            {
+                std::cout << "Rejected session resume from client '" << from << "' for id '" << request.id << "'." << std::endl;
+
+                SendTo(from, PacketType::S2C_ResumeRejected, from);
+
+                return;
+            }
+
+            SendTo(client->id, PacketType::S2C_AssignNetworkId, client->id);
+
+            std::cout << "Client '" << client->stringId << "' resumed session '" << client->id << "' from sequence '" << request.lastSequence << "'." << std::endl;
+
+            for (auto& callback : onClientResumedCallbackList)
+                callback(client->id, from, request.lastSequence);
         }
 
         void HandlePacket(const NetworkId from, const PacketHeader& header, std::vector<std::uint8_t>&& data)
         {
+            if (header.type == PacketType::C2S_ResumeSession)
+            {
+                HandleResume(from, data);
+
+                return;
+            }
+
             if (const auto iterator = packetHandlerMap.find(header.type); iterator != packetHandlerMap.end())
             {
                 for (auto& function : iterator->second)
@@ -332,8 +641,16 @@ namespace Blaster::Server::Network
         std::atomic<NetworkId> nextId = 0;
 
         std::vector<std::function<void(std::shared_ptr<ClientReference>)>> onClientDisconnectedCallbackList;
+        std::vector<std::function<void(NetworkId, NetworkId, std::uint64_t)>> onClientResumedCallbackList;
+
+        mutable std::shared_mutex clientMutex;
 
         std::unordered_map<NetworkId, std::shared_ptr<ClientReference>> clientMap;
+        std::unordered_map<NetworkId, std::shared_ptr<ParkedSession>> parkedSessionMap;
+
+        InboundPolicy inboundPolicy{};
+
+        inline static constexpr std::chrono::seconds kResumeGracePeriod{ 15 };
 
         std::unordered_map<PacketType, std::vector<std::function<void(NetworkId, std::vector<std::uint8_t>)>>> packetHandlerMap;
 
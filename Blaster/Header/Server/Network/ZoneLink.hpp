@@ -0,0 +1,288 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <array>
+#include <deque>
+#include <iostream>
+#include <boost/asio.hpp>
+#include "Independent/Network/CommonNetwork.hpp"
+#include "Independent/Network/ZoneHandoff.hpp"
+#include "Server/Network/ServerNetwork.hpp"
+#include "Server/Zone/ZoneLayout.hpp"
+
+using namespace Blaster::Independent::Network;
+using namespace Blaster::Server::Zone;
+
+namespace Blaster::Server::Network
+{
+    class ZoneLink final
+    {
+
+    public:
+
+        ZoneLink(const ZoneLink&) = delete;
+        ZoneLink(ZoneLink&&) = delete;
+        ZoneLink& operator=(const ZoneLink&) = delete;
+        ZoneLink& operator=(ZoneLink&&) = delete;
+
+        void Initialize(const ZoneLayout& layout, const int selfIndex)
+        {
+            if (running)
+                return;
+
+            auto& ioContext = ServerNetwork::GetInstance().GetIoContext();
+
+            this->selfIndex = selfIndex;
+
+            strand.emplace(boost::asio::make_strand(ioContext));
+
+            for (const auto& zone : layout.GetZones())
+            {
+                if (zone.index == selfIndex)
+                {
+                    acceptor.emplace(ioContext, TcpProtocol::endpoint(TcpProtocol::v4(), zone.peerPort));
+                    continue;
+                }
+
+                TcpProtocol::resolver resolver{ ioContext };
+
+                const auto peer = std::make_shared<Peer>(ioContext);
+
+                peer->index = zone.index;
+                peer->endpoints = resolver.resolve(zone.host, std::to_string(zone.peerPort));
+
+                peerMap[zone.index] = peer;
+            }
+
+            running = true;
+
+            boost::asio::post(*strand, [this]
+                {
+                    if (acceptor.has_value())
+                        DoAccept();
+
+                    for (const auto& peer : peerMap | std::views::values)
+                        Connect(peer);
+                });
+        }
+
+        void RegisterReceiver(const PacketType type, std::function<void(int, std::vector<std::uint8_t>)> function)
+        {
+            packetHandlerMap[type].push_back(std::move(function));
+        }
+
+        template <typename... Args> requires DataConvertible<Args...>
+        void SendTo(const int zoneIndex, const PacketType type, Args&&... args)
+        {
+            const auto hit = peerMap.find(zoneIndex);
+
+            if (hit == peerMap.end())
+                return;
+
+            auto buffer = std::make_shared<std::vector<std::uint8_t>>(CommonNetwork::BuildPacket(type, static_cast<NetworkId>(selfIndex), std::forward<Args>(args)...));
+
+            boost::asio::post(*strand, [this, peer = hit->second, buffer]
+                {
+                    peer->writeQueue.push_back(buffer);
+
+                    if (peer->connected && peer->writeQueue.size() == 1)
+                        StartWrite(peer);
+                });
+        }
+
+        [[nodiscard]]
+        bool IsRunning() const
+        {
+            return running;
+        }
+
+        [[nodiscard]]
+        int GetSelfIndex() const
+        {
+            return selfIndex;
+        }
+
+        void Uninitialize()
+        {
+            if (!running)
+                return;
+
+            ErrorCode ignored;
+
+            if (acceptor.has_value())
+                acceptor->close(ignored);
+
+            for (const auto& peer : peerMap | std::views::values)
+                peer->socket.close(ignored);
+
+            running = false;
+        }
+
+        static ZoneLink& GetInstance()
+        {
+            std::call_once(initializationFlag, [&]()
+            {
+                instance = std::unique_ptr<ZoneLink>(new ZoneLink());
+            });
+
+            return *instance;
+        }
+
+    private:
+
+        struct Peer
+        {
+            int index{ 0 };
+
+            TcpProtocol::resolver::results_type endpoints;
+            TcpProtocol::socket socket;
+
+            bool connected{ false };
+
+            std::deque<std::shared_ptr<std::vector<std::uint8_t>>> writeQueue;
+
+            boost::asio::steady_timer retryTimer;
+
+            explicit Peer(boost::asio::io_context& context) : socket(context), retryTimer(context) { }
+        };
+
+        struct Inbound
+        {
+            TcpProtocol::socket socket;
+
+            std::array<std::uint8_t, 4096> readBuffer{};
+            std::vector<std::uint8_t> inbox;
+
+            explicit Inbound(TcpProtocol::socket socket) : socket(std::move(socket)) { }
+        };
+
+        ZoneLink() = default;
+
+        void Connect(const std::shared_ptr<Peer>& peer)
+        {
+            if (!running)
+                return;
+
+            boost::asio::async_connect(peer->socket, peer->endpoints, boost::asio::bind_executor(*strand, [this, peer](const ErrorCode& errorCode, const TcpProtocol::endpoint&)
+                {
+                    if (errorCode)
+                    {
+                        ScheduleReconnect(peer);
+                        return;
+                    }
+
+                    peer->socket.set_option(TcpProtocol::no_delay(true));
+                    peer->connected = true;
+
+                    std::cout << "Connected to zone '" << peer->index << "'." << std::endl;
+
+                    if (!peer->writeQueue.empty())
+                        StartWrite(peer);
+                }));
+        }
+
+        void ScheduleReconnect(const std::shared_ptr<Peer>& peer)
+        {
+            ErrorCode ignored;
+
+            peer->connected = false;
+            peer->socket.close(ignored);
+
+            peer->retryTimer.expires_after(kReconnectInterval);
+            peer->retryTimer.async_wait(boost::asio::bind_executor(*strand, [this, peer](const ErrorCode& errorCode)
+                {
+                    if (!errorCode)
+                        Connect(peer);
+                }));
+        }
+
+        void StartWrite(const std::shared_ptr<Peer>& peer)
+        {
+            boost::asio::async_write(peer->socket, boost::asio::buffer(*peer->writeQueue.front()), boost::asio::bind_executor(*strand, [this, peer](const ErrorCode& error, std::size_t)
+                {
+                    if (error)
+                    {
+                        std::cerr << "Lost link to zone '" << peer->index << "': " << error.message() << std::endl;
+
+                        ScheduleReconnect(peer);
+
+                        return;
+                    }
+
+                    peer->writeQueue.pop_front();
+
+                    if (!peer->writeQueue.empty())
+                        StartWrite(peer);
+                }));
+        }
+
+        void DoAccept()
+        {
+            acceptor->async_accept(boost::asio::bind_executor(*strand, [this](const ErrorCode& errorCode, TcpProtocol::socket socket)
+                {
+                    if (!errorCode)
+                    {
+                        socket.set_option(TcpProtocol::no_delay(true));
+
+                        BeginRead(std::make_shared<Inbound>(std::move(socket)));
+                    }
+
+                    if (running)
+                        DoAccept();
+                }));
+        }
+
+        void BeginRead(const std::shared_ptr<Inbound>& inbound)
+        {
+            inbound->socket.async_read_some(boost::asio::buffer(inbound->readBuffer), boost::asio::bind_executor(*strand, [this, inbound](const ErrorCode& errorCode, const std::size_t number)
+                {
+                    if (errorCode)
+                        return;
+
+                    inbound->inbox.insert(inbound->inbox.end(), inbound->readBuffer.data(), inbound->readBuffer.data() + number);
+
+                    while (inbound->inbox.size() >= sizeof(PacketHeader))
+                    {
+                        const PacketHeader header = *reinterpret_cast<const PacketHeader*>(inbound->inbox.data());
+
+                        const std::size_t needed = sizeof(PacketHeader) + header.size;
+
+                        if (inbound->inbox.size() < needed)
+                            break;
+
+                        std::vector<std::uint8_t> payload(inbound->inbox.begin() + sizeof(PacketHeader), inbound->inbox.begin() + needed);
+
+                        inbound->inbox.erase(inbound->inbox.begin(), inbound->inbox.begin() + needed);
+
+                        if (const auto iterator = packetHandlerMap.find(header.type); iterator != packetHandlerMap.end())
+                        {
+                            for (auto& function : iterator->second)
+                                function(static_cast<int>(header.from), payload);
+                        }
+                    }
+
+                    BeginRead(inbound);
+                }));
+        }
+
+        int selfIndex{ 0 };
+
+        std::atomic<bool> running = false;
+
+        std::optional<boost::asio::strand<boost::asio::io_context::executor_type>> strand;
+        std::optional<TcpProtocol::acceptor> acceptor;
+
+        std::unordered_map<int, std::shared_ptr<Peer>> peerMap;
+        std::unordered_map<PacketType, std::vector<std::function<void(int, std::vector<std::uint8_t>)>>> packetHandlerMap;
+
+        inline static constexpr std::chrono::seconds kReconnectInterval{ 1 };
+
+        static std::once_flag initializationFlag;
+        static std::unique_ptr<ZoneLink> instance;
+
+    };
+
+    std::once_flag ZoneLink::initializationFlag;
+    std::unique_ptr<ZoneLink> ZoneLink::instance;
+}
\ No newline at end of file
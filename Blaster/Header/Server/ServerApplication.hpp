@@ -4,6 +4,7 @@
 #include <mutex>
 #include <iostream> 
 #include <random>
+#include <cstdlib>
 #include "Client/Render/Model.hpp"
 #include "Client/Render/TextureFuture.hpp"
 #include "Independent/Physics/Colliders/ColliderBox.hpp"
@@ -13,10 +14,13 @@
 #include "Independent/ECS/Synchronization/ReceiverSynchronization.hpp"
 #include "Independent/ECS/Synchronization/SenderSynchronization.hpp"
 #include "Independent/Test/PhysicsDebugger.hpp"
+#include "Independent/Network/AssetTransfer.hpp"
 #include "Independent/Thread/MainThreadExecutor.hpp"
+#include "Independent/Utility/AssetCache.hpp"
 #include "Independent/Utility/Time.hpp"
 #include "Server/Entity/Entities/EntityPlayer.hpp"
 #include "Server/Network/ServerNetwork.hpp"
+#include "Server/Zone/ZoneAuthority.hpp"
 
 using namespace Blaster::Server::Entity::Entities;
 using namespace Blaster::Independent::ECS::Synchronization;
@@ -25,6 +29,7 @@ using namespace Blaster::Independent::Physics;
 using namespace Blaster::Independent::Test;
 using namespace Blaster::Independent::Thread;
 using namespace Blaster::Server::Network;
+using namespace Blaster::Server::Zone;
 
 namespace Blaster::Server
 {
@@ -40,6 +45,8 @@ namespace Blaster::Server
 
         void PreInitialize()
         {
+            EntityPlayer::RegisterPrefabs();
+
 #ifdef _WIN32
             PhysicsDebugger::Initialize();
 #endif
@@ -47,17 +54,53 @@ namespace Blaster::Server
 
         void Initialize()
         {
+            if (const char* snapshotRate = std::getenv("BLASTER_SNAPSHOT_RATE"); snapshotRate != nullptr)
+                SnapshotScheduler::GetInstance().Configure(static_cast<std::uint32_t>(std::strtoul(snapshotRate, nullptr, 10)));
+
+            if (const char* demoPath = std::getenv("BLASTER_DEMO_RECORD"); demoPath != nullptr)
+                DemoRecorder::GetInstance().Start(demoPath);
+
             std::uint16_t port;
 
+            int zone;
+
             std::cout << "Enter PORT: ";
             std::cin >> port;
+
+            std::cout << "Enter ZONE (-1 for the whole world): ";
+            std::cin >> zone;
             
             ServerNetwork::GetInstance().Initialize(port);
 
+            if (zone >= 0)
+            {
+                if (const auto layout = ZoneLayout::Load({ "Blaster", "Zone/Zones.txt" }); layout.has_value())
+                    ZoneAuthority::GetInstance().Initialize(layout.value(), zone);
+            }
+
             ServerNetwork::GetInstance().AddOnClientDisconnectedCallback([&](auto client)
                 {
                     for (const auto& gameObjectPath : client->ownedGameObjectList | std::views::keys)
                         GameObjectManager::GetInstance().Unregister(gameObjectPath);
+
+                    SyncTracker::GetInstance().ForgetPeer(client->id);
+
+                    MainThreadExecutor::GetInstance().EnqueueTask(nullptr, [id = client->id]
+                    {
+                        SenderSynchronization::GetInstance().ForgetClient(id);
+                    });
+                });
+
+            ServerNetwork::GetInstance().AddOnClientResumedCallback([](const NetworkId who, const NetworkId provisional, const std::uint64_t lastSequence)
+                {
+                    SyncTracker::GetInstance().ForgetPeer(provisional);
+
+                    MainThreadExecutor::GetInstance().EnqueueTask(nullptr, [who, provisional, lastSequence]
+                    {
+                        CongestionController::GetInstance().ForgetClient(who);
+                        SenderSynchronization::GetInstance().ForgetClient(provisional);
+                        SenderSynchronization::GetInstance().ResumeClient(who, lastSequence, GameObjectManager::GetInstance().GetAll());
+                    });
                 });
 
             ServerNetwork::GetInstance().RegisterReceiver(PacketType::C2S_StringId, [](const NetworkId who, std::vector<std::uint8_t> data)
@@ -78,43 +121,146 @@ namespace Blaster::Server
 
                     ServerNetwork::GetInstance().GetClient(who).value()->stringId = name;
 
-                    auto player = GameObjectManager::GetInstance().Register(GameObject::Create("player-" + name, false, who));
+                    const auto team = randomNumber == 1 ? EntityPlayer::Team::Red : EntityPlayer::Team::Blue;
+                    const Vector<float, 3> position = randomNumber == 1 ? Vector<float, 3>{ 418.87f, -190.0f, 13.19f } : Vector<float, 3>{ -411.66f, -190.0f, 7.50f };
+
+                    auto player = GameObjectManager::GetInstance().Instantiate("blaster.player", "player-" + name, ".", who, [&](const std::string&, const std::shared_ptr<Component>& component)
+                        {
+                            if (const auto transform = std::dynamic_pointer_cast<Transform3d>(component))
+                                transform->SetLocalPosition(position, false);
+                            else if (const auto entity = std::dynamic_pointer_cast<EntityPlayer>(component))
+                                entity->SetTeam(team);
+                        });
+
+                    if (!player)
+                        return;
+
+                    SenderSynchronization::GetInstance().SetInterestFocus(who, player, player->GetTransform3d()->GetWorldPosition());
                     
-                    if (randomNumber == 1)
+                    SenderSynchronization::GetInstance().SynchronizeFullTree(who, GameObjectManager::GetInstance().GetAll());
+                });
+
+            ServerNetwork::GetInstance().RegisterReceiver(PacketType::C2S_RelayHello, [](const NetworkId who, std::vector<std::uint8_t> data)
+                {
+                    const auto key = std::any_cast<std::string>(CommonNetwork::DisassembleData(data)[0]);
+                    const char* relayKey = std::getenv("BLASTER_RELAY_KEY");
+
+                    if (relayKey == nullptr || key != relayKey)
                     {
-                        player->AddComponent(EntityPlayer::Create(EntityPlayer::Team::Red));
+                        ServerNetwork::GetInstance().ReportViolation(who, "bad relay key");
 
-                        player->GetTransform3d()->SetLocalPosition({ 418.87f, -190.0f, 13.19f });
+                        return;
                     }
-                    else
+
+                    const auto client = ServerNetwork::GetInstance().GetClient(who).value();
+
+                    client->relay = true;
+                    client->stringId = "relay-" + std::to_string(who);
+
+                    std::cout << "Client " << who << " is a spectator relay." << std::endl;
+
+                    if (const char* relayRate = std::getenv("BLASTER_RELAY_SNAPSHOT_RATE"); relayRate != nullptr)
+                        SnapshotScheduler::GetInstance().SetClientRate(who, static_cast<std::uint32_t>(std::strtoul(relayRate, nullptr, 10)));
+
+                    MainThreadExecutor::GetInstance().EnqueueTask(nullptr, [who]
                     {
-                        player->AddComponent(EntityPlayer::Create(EntityPlayer::Team::Blue));
+                        SenderSynchronization::GetInstance().SynchronizeFullTree(who, GameObjectManager::GetInstance().GetAll());
+                    });
+                });
 
-                        player->GetTransform3d()->SetLocalPosition({ -411.66f, -190.0f, 7.50f });
-                    }
-                    
-                    player->AddComponent(CharacterController::Create(1.45f, 8.0f));
-                    
-                    SenderSynchronization::GetInstance().SynchronizeFullTree(who, GameObjectManager::GetInstance().GetAll());
+            AssetCache::GetInstance().SetRequestFunction([](const AssetHash& hash)
+                {
+                    ServerNetwork::GetInstance().Broadcast(PacketType::S2C_AssetRequest, std::nullopt, AssetRequest{ hash });
                 });
 
-            ServerNetwork::GetInstance().RegisterReceiver(PacketType::C2S_Snapshot, [](const NetworkId whoIn, std::vector<std::uint8_t> messageIn)
+            ServerNetwork::GetInstance().RegisterReceiver(PacketType::C2S_AssetRequest, [](const NetworkId who, std::vector<std::uint8_t> data)
+                {
+                    auto anyList = CommonNetwork::DisassembleData(data);
+
+                    if (anyList.empty())
+                        return;
+
+                    const AssetHash hash = std::any_cast<const AssetRequest&>(anyList.front()).hash;
+
+                    AssetCache::GetInstance().Require(hash, [who, hash](const std::string& bytes)
+                        {
+                            ServerNetwork::GetInstance().SendTo(who, PacketType::S2C_AssetData, AssetData{ hash, { bytes.begin(), bytes.end() } });
+                        });
+                });
+
+            ServerNetwork::GetInstance().RegisterReceiver(PacketType::C2S_AssetData, [](const NetworkId who, std::vector<std::uint8_t> data)
                 {
-                    MainThreadExecutor::GetInstance().EnqueueTask(nullptr, [message = messageIn]
+                    auto anyList = CommonNetwork::DisassembleData(data);
+
+                    if (anyList.empty())
+                        return;
+
+                    const auto& asset = std::any_cast<const AssetData&>(anyList.front());
+
+                    if (!AssetCache::GetInstance().Store(asset.hash, { asset.bytes.begin(), asset.bytes.end() }))
+                        std::cerr << "Discarded asset '" << Sha256::ToHex(asset.hash) << "' from client " << who << "." << std::endl;
+                });
+
+            ServerNetwork::GetInstance().RegisterReceiver(PacketType::C2S_BaselineMiss, [](const NetworkId who, std::vector<std::uint8_t> data)
+                {
+                    auto anyList = CommonNetwork::DisassembleData(data);
+
+                    if (anyList.empty())
+                        return;
+
+                    BaselineMiss miss = std::any_cast<BaselineMiss>(std::move(anyList.front()));
+
+                    MainThreadExecutor::GetInstance().EnqueueTask(nullptr, [who, miss = std::move(miss)]
                     {
-                        ReceiverSynchronization::GetInstance().HandleSnapshotPayload(message);
+                        if (const auto gameObject = GameObjectManager::GetInstance().Get(miss.path); gameObject.has_value())
+                            SenderSynchronization::GetInstance().ResendFullState(who, gameObject.value(), miss.componentType);
                     });
-                    
+                });
+
+            ServerNetwork::GetInstance().RegisterReceiver(PacketType::C2S_Snapshot, [](const NetworkId whoIn, std::vector<std::uint8_t> messageIn)
+                {
                     auto any = CommonNetwork::DisassembleData(messageIn);
                     
+                    if (any.empty())
+                        return;
+
                     auto& snapshot = std::any_cast<Snapshot&>(any[0]);
 
+                    if (snapshot.header.operationCount > ServerNetwork::GetInstance().GetInboundPolicy().maximumOperationsPerSnapshot)
+                    {
+                        ServerNetwork::GetInstance().ReportViolation(whoIn, "too many operations in snapshot");
+
+                        return;
+                    }
+
+                    if (snapshot.header.origin != whoIn)
+                    {
+                        ServerNetwork::GetInstance().ReportViolation(whoIn, "snapshot origin does not match sender");
+
+                        return;
+                    }
+
+                    if (const auto sender = ServerNetwork::GetInstance().GetClient(whoIn); sender.has_value() && sender.value()->relay && snapshot.header.operationCount != 0)
+                    {
+                        ServerNetwork::GetInstance().ReportViolation(whoIn, "relay sent operations");
+
+                        return;
+                    }
+
+                    ReceiverSynchronization::GetInstance().EnqueueSnapshotPayload(messageIn);
+
+                    if (snapshot.header.route != Route::RelayOnce)
+                        return;
+
                     MainThreadExecutor::GetInstance().EnqueueTask(nullptr, [snapshot = std::move(snapshot), who = whoIn, message = messageIn]
                     {
-                        for (NetworkId id : ServerNetwork::GetInstance().GetConnectedClients())
+                        for (NetworkId id : SenderSynchronization::GetSessionClients())
                         {
-                            if (id != who)
-                                ServerNetwork::GetInstance().SendTo(id, PacketType::S2C_Snapshot, snapshot);
+                            if (id == who)
+                                continue;
+
+                            ServerNetwork::GetInstance().SendTo(id, PacketType::S2C_Snapshot, snapshot);
+                            SyncTracker::GetInstance().RecordOutgoing(id, snapshot, true);
                         }
                     });
                 });
@@ -238,17 +384,35 @@ namespace Blaster::Server
 
             PhysicsSystem::GetInstance().Update();
 
+            ZoneAuthority::GetInstance().Update();
+
+            for (const auto& root : GameObjectManager::GetInstance().GetAll())
+                SenderSynchronization::GetInstance().TrackInterest(root, root->GetTransform3d()->GetWorldPosition());
+
+            SenderSynchronization::GetInstance().PumpJoinStreams();
+
+            AssetCache::GetInstance().Pump();
+
+            SenderSynchronization::GetInstance().Tick();
+
+            if (DemoRecorder::GetInstance().IsKeyframeDue())
+                DemoRecorder::GetInstance().RecordKeyframe(SenderSynchronization::GetInstance().BuildFullSnapshot(GameObjectManager::GetInstance().GetAll()));
+
             Time::GetInstance().Update();
         }
 
         void Uninitialize()
         {
+            DemoRecorder::GetInstance().Stop();
+
 #ifdef _WIN32
             PhysicsDebugger::Uninitialize();
 #endif
 
             PhysicsWorld::GetInstance().Uninitialize();
 
+            ZoneAuthority::GetInstance().Uninitialize();
+
             ServerNetwork::GetInstance().Uninitialize();
         }
 
@@ -0,0 +1,315 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <chrono>
+#include <iostream>
+#include "Independent/ECS/GameObjectManager.hpp"
+#include "Independent/ECS/Synchronization/ReceiverSynchronization.hpp"
+#include "Independent/ECS/Synchronization/SenderSynchronization.hpp"
+#include "Independent/Physics/PhysicsBody.hpp"
+#include "Independent/Physics/Rigidbody.hpp"
+#include "Independent/Thread/MainThreadExecutor.hpp"
+#include "Server/Network/ServerNetwork.hpp"
+#include "Server/Network/ZoneLink.hpp"
+#include "Server/Zone/ZoneLayout.hpp"
+
+using namespace Blaster::Independent::ECS;
+using namespace Blaster::Independent::ECS::Synchronization;
+using namespace Blaster::Independent::Physics;
+using namespace Blaster::Independent::Thread;
+using namespace Blaster::Server::Network;
+
+namespace Blaster::Server::Zone
+{
+    class ZoneAuthority final
+    {
+
+    public:
+
+        ZoneAuthority(const ZoneAuthority&) = delete;
+        ZoneAuthority(ZoneAuthority&&) = delete;
+        ZoneAuthority& operator=(const ZoneAuthority&) = delete;
+        ZoneAuthority& operator=(ZoneAuthority&&) = delete;
+
+        void Initialize(const ZoneLayout& layout, const int selfIndex)
+        {
+            const auto self = layout.Get(selfIndex);
+
+            if (!self.has_value())
+            {
+                std::cerr << "Zone layout does not contain zone '" << selfIndex << "'; running as the whole world." << std::endl;
+                return;
+            }
+
+            this->layout = layout;
+            this->self = self.value();
+
+            ZoneLink::GetInstance().RegisterReceiver(PacketType::S2S_EntityHandoff, [this](const int from, std::vector<std::uint8_t> data)
+                {
+                    auto handoff = std::any_cast<EntityHandoff>(CommonNetwork::DisassembleData(data)[0]);
+
+                    MainThreadExecutor::GetInstance().EnqueueTask(nullptr, [this, from, handoff = std::move(handoff)]
+                    {
+                        AcceptIncoming(from, handoff);
+                    });
+                });
+
+            ZoneLink::GetInstance().RegisterReceiver(PacketType::S2S_HandoffAccepted, [this](const int, std::vector<std::uint8_t> data)
+                {
+                    const auto accepted = std::any_cast<HandoffToken>(CommonNetwork::DisassembleData(data)[0]);
+
+                    MainThreadExecutor::GetInstance().EnqueueTask(nullptr, [this, accepted]
+                    {
+                        CompleteOutgoing(accepted.token);
+                    });
+                });
+
+            ServerNetwork::GetInstance().RegisterReceiver(PacketType::C2S_ClaimHandoff, [this](const NetworkId who, std::vector<std::uint8_t> data)
+                {
+                    const auto token = std::any_cast<HandoffToken>(CommonNetwork::DisassembleData(data)[0]).token;
+
+                    MainThreadExecutor::GetInstance().EnqueueTask(nullptr, [this, who, token]
+                    {
+                        Claim(who, token);
+                    });
+                });
+
+            ZoneLink::GetInstance().Initialize(layout, selfIndex);
+
+            enabled = true;
+
+            std::cout << "Serving zone '" << selfIndex << "' (x in [" << this->self.minimumX << ", " << this->self.maximumX << "))." << std::endl;
+        }
+
+        [[nodiscard]]
+        bool IsEnabled() const
+        {
+            return enabled;
+        }
+
+        [[nodiscard]]
+        bool Owns(const Vector<float, 3>& position) const
+        {
+            return !enabled || self.Contains(position);
+        }
+
+        void Update()
+        {
+            if (!enabled)
+                return;
+
+            const auto now = std::chrono::steady_clock::now();
+
+            std::erase_if(pendingIncomingMap, [now](const auto& entry) { return entry.second.deadline < now; });
+            std::erase_if(outgoingMap, [now](const auto& entry) { return entry.second.deadline < now; });
+
+            for (const auto& root : GameObjectManager::GetInstance().GetAll())
+            {
+                if (!IsMigratable(root))
+                    continue;
+
+                const std::string path = root->GetAbsolutePath();
+
+                if (std::ranges::any_of(outgoingMap | std::views::values, [&path](const OutgoingHandoff& handoff) { return handoff.path == path; }))
+                    continue;
+
+                const Vector<float, 3> position = root->GetTransform3d()->GetWorldPosition();
+
+                if (self.Contains(position, kHandoffMargin))
+                    continue;
+
+                const auto target = layout.Find(position);
+
+                if (!target.has_value() || target->index == self.index)
+                    continue;
+
+                BeginHandoff(root, target.value());
+            }
+        }
+
+        void Uninitialize()
+        {
+            if (!enabled)
+                return;
+
+            ZoneLink::GetInstance().Uninitialize();
+
+            enabled = false;
+        }
+
+        static ZoneAuthority& GetInstance()
+        {
+            std::call_once(initializationFlag, [&]()
+            {
+                instance = std::unique_ptr<ZoneAuthority>(new ZoneAuthority());
+            });
+
+            return *instance;
+        }
+
+    private:
+
+        struct OutgoingHandoff
+        {
+            std::string path;
+            std::optional<NetworkId> owner;
+
+            ZoneDefinition target;
+
+            std::chrono::steady_clock::time_point deadline;
+        };
+
+        struct PendingHandoff
+        {
+            EntityHandoff handoff;
+
+            std::chrono::steady_clock::time_point deadline;
+        };
+
+        ZoneAuthority() = default;
+
+        static bool IsMigratable(const std::shared_ptr<GameObject>& root)
+        {
+            for (const auto& component : root->GetComponentOrder())
+            {
+                if (const auto rigidbody = std::dynamic_pointer_cast<Rigidbody>(component))
+                    return rigidbody->GetBodyType() != Rigidbody::Type::STATIC;
+
+                if (std::dynamic_pointer_cast<PhysicsBody>(component))
+                    return true;
+            }
+
+            return false;
+        }
+
+        void BeginHandoff(const std::shared_ptr<GameObject>& root, const ZoneDefinition& target)
+        {
+            EntityHandoff handoff{};
+
+            handoff.token = Blaster::Independent::Utility::SecureRandom::NextToken();
+            handoff.path = root->GetAbsolutePath();
+            handoff.hasOwner = root->GetOwningClient().has_value();
+
+            if (handoff.hasOwner)
+            {
+                const auto client = ServerNetwork::GetInstance().GetClient(root->GetOwningClient().value());
+
+                if (!client.has_value())
+                    return;
+
+                handoff.stringId = client.value()->stringId;
+            }
+
+            Snapshot subTree = SenderSynchronization::GetInstance().SerializeHandoff(std::static_pointer_cast<IGameObjectSynchronization>(root));
+
+            handoff.operationCount = subTree.header.operationCount;
+            handoff.operationBlob = std::move(subTree.operationBlob);
+
+            outgoingMap[handoff.token] = { handoff.path, root->GetOwningClient(), target, std::chrono::steady_clock::now() + kHandoffTimeout };
+
+            ZoneLink::GetInstance().SendTo(target.index, PacketType::S2S_EntityHandoff, handoff);
+
+            std::cout << "Handing '" << handoff.path << "' off to zone '" << target.index << "'." << std::endl;
+        }
+
+        void CompleteOutgoing(const std::uint64_t token)
+        {
+            const auto hit = outgoingMap.find(token);
+
+            if (hit == outgoingMap.end())
+                return;
+
+            const OutgoingHandoff outgoing = std::move(hit->second);
+
+            outgoingMap.erase(hit);
+
+            if (outgoing.owner.has_value())
+            {
+                if (const auto client = ServerNetwork::GetInstance().GetClient(outgoing.owner.value()); client.has_value())
+                {
+                    client.value()->redirected = true;
+
+                    ServerNetwork::GetInstance().SendTo(outgoing.owner.value(), PacketType::S2C_ZoneRedirect, ZoneRedirect{ outgoing.target.host, outgoing.target.clientPort, token });
+                }
+            }
+
+            GameObjectManager::GetInstance().Unregister(outgoing.path);
+        }
+
+        void AcceptIncoming(const int from, const EntityHandoff& handoff)
+        {
+            if (handoff.hasOwner)
+                pendingIncomingMap[handoff.token] = { handoff, std::chrono::steady_clock::now() + kHandoffTimeout };
+            else
+                Instantiate(handoff, std::nullopt);
+
+            ZoneLink::GetInstance().SendTo(from, PacketType::S2S_HandoffAccepted, HandoffToken{ handoff.token });
+        }
+
+        void Claim(const NetworkId who, const std::uint64_t token)
+        {
+            const auto hit = pendingIncomingMap.find(token);
+
+            if (hit == pendingIncomingMap.end())
+            {
+                ServerNetwork::GetInstance().ReportViolation(who, "unknown handoff token");
+                return;
+            }
+
+            const EntityHandoff handoff = std::move(hit->second.handoff);
+
+            pendingIncomingMap.erase(hit);
+
+            const auto client = ServerNetwork::GetInstance().GetClient(who);
+
+            if (!client.has_value())
+                return;
+
+            client.value()->stringId = handoff.stringId;
+
+            std::cout << "Client " << who << " ('" << handoff.stringId << "') arrived from another zone." << std::endl;
+
+            Instantiate(handoff, who);
+
+            if (const auto root = GameObjectManager::GetInstance().Get(handoff.path); root.has_value())
+                SenderSynchronization::GetInstance().SetInterestFocus(who, root.value(), root.value()->GetTransform3d()->GetWorldPosition());
+
+            SenderSynchronization::GetInstance().SynchronizeFullTree(who, GameObjectManager::GetInstance().GetAll());
+        }
+
+        static void Instantiate(const EntityHandoff& handoff, const std::optional<NetworkId>& owner)
+        {
+            if (GameObjectManager::GetInstance().Has(handoff.path))
+                GameObjectManager::GetInstance().Unregister(handoff.path);
+
+            Snapshot subTree{};
+
+            subTree.header.operationCount = handoff.operationCount;
+            subTree.operationBlob = handoff.operationBlob;
+
+            ReceiverSynchronization::GetInstance().ApplyHandoff(std::move(subTree), owner);
+
+            if (!GameObjectManager::GetInstance().Has(handoff.path))
+                std::cerr << "Handoff of '" << handoff.path << "' did not recreate its root!" << std::endl;
+        }
+
+        bool enabled = false;
+
+        ZoneLayout layout;
+        ZoneDefinition self;
+
+        std::unordered_map<std::uint64_t, OutgoingHandoff> outgoingMap;
+        std::unordered_map<std::uint64_t, PendingHandoff> pendingIncomingMap;
+
+        inline static constexpr float kHandoffMargin = 4.0f;
+        inline static constexpr std::chrono::seconds kHandoffTimeout{ 15 };
+
+        static std::once_flag initializationFlag;
+        static std::unique_ptr<ZoneAuthority> instance;
+
+    };
+
+    std::once_flag ZoneAuthority::initializationFlag;
+    std::unique_ptr<ZoneAuthority> ZoneAuthority::instance;
+}
\ No newline at end of file
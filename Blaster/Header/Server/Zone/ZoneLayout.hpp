@@ -0,0 +1,114 @@
+#pragma once
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <optional>
+#include <iostream>
+#include "Independent/Math/Vector.hpp"
+#include "Independent/Utility/AssetPath.hpp"
+
+using namespace Blaster::Independent::Math;
+using namespace Blaster::Independent::Utility;
+
+namespace Blaster::Server::Zone
+{
+    struct ZoneDefinition
+    {
+        int index{ 0 };
+
+        float minimumX{ 0.0f };
+        float maximumX{ 0.0f };
+
+        std::string host;
+
+        std::uint16_t clientPort{ 0 };
+        std::uint16_t peerPort{ 0 };
+
+        [[nodiscard]]
+        bool Contains(const Vector<float, 3>& position, const float margin = 0.0f) const
+        {
+            return position.x() >= minimumX - margin && position.x() < maximumX + margin;
+        }
+    };
+
+    class ZoneLayout final
+    {
+
+    public:
+
+        static std::optional<ZoneLayout> Load(const AssetPath& path)
+        {
+            std::ifstream stream(path.GetFullPath());
+
+            if (!stream.is_open())
+            {
+                std::cerr << "Failed to open zone layout '" << path.GetFullPath() << "'!" << std::endl;
+                return std::nullopt;
+            }
+
+            ZoneLayout result;
+
+            std::string line;
+
+            while (std::getline(stream, line))
+            {
+                if (line.empty() || line.front() == '#')
+                    continue;
+
+                std::istringstream lineStream(line);
+
+                ZoneDefinition zone;
+
+                if (!(lineStream >> zone.index >> zone.minimumX >> zone.maximumX >> zone.host >> zone.clientPort >> zone.peerPort))
+                {
+                    std::cerr << "Malformed zone layout line '" << line << "'!" << std::endl;
+                    continue;
+                }
+
+                result.zoneList.push_back(zone);
+            }
+
+            if (result.zoneList.empty())
+                return std::nullopt;
+
+            return result;
+        }
+
+        [[nodiscard]]
+        std::optional<ZoneDefinition> Get(const int index) const
+        {
+            for (const auto& zone : zoneList)
+            {
+                if (zone.index == index)
+                    return zone;
+            }
+
+            return std::nullopt;
+        }
+
+        [[nodiscard]]
+        std::optional<ZoneDefinition> Find(const Vector<float, 3>& position) const
+        {
+            for (const auto& zone : zoneList)
+            {
+                if (zone.Contains(position))
+                    return zone;
+            }
+
+            return std::nullopt;
+        }
+
+        [[nodiscard]]
+        const std::vector<ZoneDefinition>& GetZones() const
+        {
+            return zoneList;
+        }
+
+    private:
+
+        std::vector<ZoneDefinition> zoneList;
+
+    };
+}
\ No newline at end of file
@@ -0,0 +1,45 @@
+#include <iostream>
+#include <string_view>
+#include "Independent/TypeRegistrations.hpp"
+#include "Independent/ComponentInclusions.hpp"
+#include "Independent/Test/ApplyAllocationCheck.hpp"
+#include "Independent/Test/DirtyJournalBenchmark.hpp"
+#include "Independent/Test/FieldDiffBenchmark.hpp"
+#include "Independent/Test/SnapshotApplyBenchmark.hpp"
+#include "Independent/Test/SnapshotBenchmark.hpp"
+#include "Independent/Test/TransformCodecCheck.hpp"
+
+using namespace Blaster::Independent::Test;
+
+int main(const int argc, char** argv)
+{
+    bool passed = true;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view name = argv[i];
+
+        if (name == "snapshot")
+            SnapshotBenchmark::Run();
+        else if (name == "snapshot-apply")
+            SnapshotApplyBenchmark::Run();
+        else if (name == "dirty-journal")
+            DirtyJournalBenchmark::Run();
+        else if (name == "field-diff")
+            FieldDiffBenchmark::Run();
+        else if (name == "transform-codec")
+            passed &= TransformCodecCheck::Run();
+        else if (name == "apply-allocations")
+            ApplyAllocationCheck::Run();
+        else
+        {
+            std::cerr << "Unknown benchmark '" << name << "'; expected snapshot, snapshot-apply, dirty-journal, field-diff, transform-codec or apply-allocations." << std::endl;
+            passed = false;
+        }
+    }
+
+    if (argc < 2)
+        std::cerr << "Usage: Bench <snapshot|snapshot-apply|dirty-journal|field-diff|transform-codec|apply-allocations>..." << std::endl;
+
+    return passed && argc >= 2 ? 0 : 1;
+}
\ No newline at end of file
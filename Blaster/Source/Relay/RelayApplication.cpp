@@ -0,0 +1,15 @@
+#include "Independent/TypeRegistrations.hpp"
+#include "Relay/RelayApplication.hpp"
+
+int main()
+{
+    auto& instance = Blaster::Relay::RelayApplication::GetInstance();
+
+    instance.PreInitialize();
+    instance.Initialize();
+
+    while (instance.IsRunning())
+        instance.Update();
+
+    instance.Uninitialize();
+}
\ No newline at end of file